@@ -46,6 +46,9 @@ namespace
             {"benchmark/str_constructor_int.py",
              {benchmark_cpp::str_constructor_int_run,
               benchmark_cpp::str_constructor_int_items}},
+            {"benchmark/str_constructor_int_digits.py",
+             {benchmark_cpp::str_constructor_int_digits_run,
+              benchmark_cpp::str_constructor_int_digits_items}},
             {"benchmark/str_constructor_string.py",
              {benchmark_cpp::str_constructor_string_run,
               benchmark_cpp::str_constructor_string_items}},
@@ -55,6 +58,16 @@ namespace
             {"benchmark/int_constructor_string.py",
              {benchmark_cpp::int_constructor_string_run,
               benchmark_cpp::int_constructor_string_items}},
+            {"benchmark/int_constructor_string_digits.py",
+             {benchmark_cpp::int_constructor_string_digits_run,
+              benchmark_cpp::int_constructor_string_digits_items}},
+            {"benchmark/bigint_mul.py",
+             {benchmark_cpp::bigint_mul_run, benchmark_cpp::bigint_mul_items}},
+            {"benchmark/float_repr.py",
+             {benchmark_cpp::float_repr_run, benchmark_cpp::float_repr_items}},
+            {"benchmark/float_parse.py",
+             {benchmark_cpp::float_parse_run,
+              benchmark_cpp::float_parse_items}},
             {"benchmark/while_loop.py",
              {benchmark_cpp::while_loop_run, benchmark_cpp::while_loop_items}},
             {"benchmark/for_loop.py",
@@ -125,6 +138,9 @@ namespace
             {"benchmark/exception_typed_handler_raise.py",
              {benchmark_cpp::exception_typed_handler_raise_run,
               benchmark_cpp::exception_typed_handler_raise_items}},
+            {"benchmark/exception_deep_unwind.py",
+             {benchmark_cpp::exception_deep_unwind_run,
+              benchmark_cpp::exception_deep_unwind_items}},
             {"benchmark/class_instantiation.py",
              {benchmark_cpp::class_instantiation_run,
               benchmark_cpp::class_instantiation_items}},
@@ -152,6 +168,15 @@ namespace
             {"benchmark/method_call.py",
              {benchmark_cpp::method_call_run,
               benchmark_cpp::method_call_items}},
+            {"benchmark/global_helper_call.py",
+             {benchmark_cpp::global_helper_call_run,
+              benchmark_cpp::global_helper_call_items}},
+            {"benchmark/forwarding_wrapper.py",
+             {benchmark_cpp::forwarding_wrapper_run,
+              benchmark_cpp::forwarding_wrapper_items}},
+            {"benchmark/forwarding_wrapper_kwargs.py",
+             {benchmark_cpp::forwarding_wrapper_kwargs_run,
+              benchmark_cpp::forwarding_wrapper_kwargs_items}},
             {"benchmark/method_keyword_call.py",
              {benchmark_cpp::method_keyword_call_run,
               benchmark_cpp::method_keyword_call_items}},
@@ -188,6 +213,24 @@ namespace
             {"benchmark/builtin_lookup.py",
              {benchmark_cpp::builtin_lookup_run,
               benchmark_cpp::builtin_lookup_items}},
+            {"benchmark/builtin_call_len.py",
+             {benchmark_cpp::builtin_call_len_run,
+              benchmark_cpp::builtin_call_len_items}},
+            {"benchmark/builtin_call_isinstance.py",
+             {benchmark_cpp::builtin_call_isinstance_run,
+              benchmark_cpp::builtin_call_isinstance_items}},
+            {"benchmark/builtin_call_hash.py",
+             {benchmark_cpp::builtin_call_hash_run,
+              benchmark_cpp::builtin_call_hash_items}},
+            {"benchmark/builtin_call_abs.py",
+             {benchmark_cpp::builtin_call_abs_run,
+              benchmark_cpp::builtin_call_abs_items}},
+            {"benchmark/builtin_call_min_max.py",
+             {benchmark_cpp::builtin_call_min_max_run,
+              benchmark_cpp::builtin_call_min_max_items}},
+            {"benchmark/builtin_call_getattr.py",
+             {benchmark_cpp::builtin_call_getattr_run,
+              benchmark_cpp::builtin_call_getattr_items}},
             {"benchmark/global_write.py",
              {benchmark_cpp::global_write_run,
               benchmark_cpp::global_write_items}},
@@ -219,6 +262,9 @@ namespace
             {"benchmark/pystone_arithmetic.py",
              {benchmark_cpp::pystone_arithmetic_run,
               benchmark_cpp::pystone_arithmetic_items}},
+            {"benchmark/thread_scaling.py",
+             {benchmark_cpp::thread_scaling_run,
+              benchmark_cpp::thread_scaling_items}},
         };
 
         auto it = cases.find(relative_path);
@@ -276,6 +322,11 @@ namespace
             return actual.get_smi();
         }
 
+        uint64_t slab_handout_count()
+        {
+            return vm_.get_refcounted_global_heap().slab_handout_count();
+        }
+
     private:
         VirtualMachine vm_;
         ThreadState *thread_;
@@ -599,6 +650,12 @@ namespace
 
             verify_benchmark_result(relative_path, n, expected, program->run());
 
+            uint64_t slabs_before = 0;
+            if constexpr(std::is_same_v<Program, CloverProgram>)
+            {
+                slabs_before = program->slab_handout_count();
+            }
+
             for(auto _: state)
             {
                 benchmark::DoNotOptimize(program->run());
@@ -608,6 +665,11 @@ namespace
 
             if constexpr(std::is_same_v<Program, CloverProgram>)
             {
+                // Heap slabs handed out per run, a proxy for allocation rate.
+                state.counters["slabs_per_run"] = benchmark::Counter(
+                    static_cast<double>(program->slab_handout_count() -
+                                        slabs_before),
+                    benchmark::Counter::kAvgIterations);
                 set_comparison_counters(state, relative_path, n, expected,
                                         items_per_iteration);
             }
@@ -877,6 +939,16 @@ BENCHMARK_TEMPLATE(BM_ExceptionTypedHandlerRaise, CloverProgram)
     ->Name("BM_ExceptionTypedHandlerRaise")
     ->Arg(10000);
 
+template <typename Program>
+static void BM_ExceptionDeepUnwind(benchmark::State &state)
+{
+    run_benchmark_case<Program>(state, "benchmark/exception_deep_unwind.py",
+                                state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_ExceptionDeepUnwind, CloverProgram)
+    ->Name("BM_ExceptionDeepUnwind")
+    ->Arg(100);
+
 template <typename Program>
 static void BM_ClassInstantiationNoInit(benchmark::State &state)
 {
@@ -917,6 +989,18 @@ BENCHMARK_TEMPLATE(BM_StrConstructorInt, CloverProgram)
     ->Name("BM_StrConstructorInt")
     ->Arg(100000);
 
+template <typename Program>
+static void BM_StrConstructorIntDigits(benchmark::State &state)
+{
+    run_benchmark_case<Program>(
+        state, "benchmark/str_constructor_int_digits.py", state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_StrConstructorIntDigits, CloverProgram)
+    ->Name("BM_StrConstructorIntDigits")
+    ->Arg(1000)
+    ->Arg(10000)
+    ->Arg(100000);
+
 template <typename Program>
 static void BM_IntConstructorInt(benchmark::State &state)
 {
@@ -937,6 +1021,50 @@ BENCHMARK_TEMPLATE(BM_IntConstructorString, CloverProgram)
     ->Name("BM_IntConstructorString")
     ->Arg(100000);
 
+template <typename Program>
+static void BM_IntConstructorStringDigits(benchmark::State &state)
+{
+    run_benchmark_case<Program>(
+        state, "benchmark/int_constructor_string_digits.py", state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_IntConstructorStringDigits, CloverProgram)
+    ->Name("BM_IntConstructorStringDigits")
+    ->Arg(1000)
+    ->Arg(10000)
+    ->Arg(100000);
+
+template <typename Program>
+static void BM_BigIntMul(benchmark::State &state)
+{
+    run_benchmark_case<Program>(state, "benchmark/bigint_mul.py",
+                                state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_BigIntMul, CloverProgram)
+    ->Name("BM_BigIntMul")
+    ->Arg(100)
+    ->Arg(1000)
+    ->Arg(10000)
+    ->Arg(100000)
+    ->Arg(1000000);
+
+template <typename Program> static void BM_FloatRepr(benchmark::State &state)
+{
+    run_benchmark_case<Program>(state, "benchmark/float_repr.py",
+                                state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_FloatRepr, CloverProgram)
+    ->Name("BM_FloatRepr")
+    ->Arg(100000);
+
+template <typename Program> static void BM_FloatParse(benchmark::State &state)
+{
+    run_benchmark_case<Program>(state, "benchmark/float_parse.py",
+                                state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_FloatParse, CloverProgram)
+    ->Name("BM_FloatParse")
+    ->Arg(100000);
+
 template <typename Program>
 static void BM_InstanceAttributeAddMember(benchmark::State &state)
 {
@@ -1007,6 +1135,36 @@ BENCHMARK_TEMPLATE(BM_MethodCall, CloverProgram)
     ->Name("BM_MethodCall")
     ->Arg(100000);
 
+template <typename Program>
+static void BM_GlobalHelperCall(benchmark::State &state)
+{
+    run_benchmark_case<Program>(state, "benchmark/global_helper_call.py",
+                                state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_GlobalHelperCall, CloverProgram)
+    ->Name("BM_GlobalHelperCall")
+    ->Arg(100000);
+
+template <typename Program>
+static void BM_ForwardingWrapper(benchmark::State &state)
+{
+    run_benchmark_case<Program>(state, "benchmark/forwarding_wrapper.py",
+                                state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_ForwardingWrapper, CloverProgram)
+    ->Name("BM_ForwardingWrapper")
+    ->Arg(100000);
+
+template <typename Program>
+static void BM_ForwardingWrapperKwargs(benchmark::State &state)
+{
+    run_benchmark_case<Program>(state, "benchmark/forwarding_wrapper_kwargs.py",
+                                state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_ForwardingWrapperKwargs, CloverProgram)
+    ->Name("BM_ForwardingWrapperKwargs")
+    ->Arg(100000);
+
 template <typename Program>
 static void BM_MethodKeywordCall(benchmark::State &state)
 {
@@ -1126,6 +1284,66 @@ BENCHMARK_TEMPLATE(BM_BuiltinLookup, CloverProgram)
     ->Name("BM_BuiltinLookup")
     ->Arg(100000);
 
+template <typename Program>
+static void BM_BuiltinCallLen(benchmark::State &state)
+{
+    run_benchmark_case<Program>(state, "benchmark/builtin_call_len.py",
+                                state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_BuiltinCallLen, CloverProgram)
+    ->Name("BM_BuiltinCallLen")
+    ->Arg(100000);
+
+template <typename Program>
+static void BM_BuiltinCallIsInstance(benchmark::State &state)
+{
+    run_benchmark_case<Program>(state, "benchmark/builtin_call_isinstance.py",
+                                state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_BuiltinCallIsInstance, CloverProgram)
+    ->Name("BM_BuiltinCallIsInstance")
+    ->Arg(100000);
+
+template <typename Program>
+static void BM_BuiltinCallHash(benchmark::State &state)
+{
+    run_benchmark_case<Program>(state, "benchmark/builtin_call_hash.py",
+                                state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_BuiltinCallHash, CloverProgram)
+    ->Name("BM_BuiltinCallHash")
+    ->Arg(100000);
+
+template <typename Program>
+static void BM_BuiltinCallAbs(benchmark::State &state)
+{
+    run_benchmark_case<Program>(state, "benchmark/builtin_call_abs.py",
+                                state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_BuiltinCallAbs, CloverProgram)
+    ->Name("BM_BuiltinCallAbs")
+    ->Arg(100000);
+
+template <typename Program>
+static void BM_BuiltinCallMinMax(benchmark::State &state)
+{
+    run_benchmark_case<Program>(state, "benchmark/builtin_call_min_max.py",
+                                state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_BuiltinCallMinMax, CloverProgram)
+    ->Name("BM_BuiltinCallMinMax")
+    ->Arg(100000);
+
+template <typename Program>
+static void BM_BuiltinCallGetattr(benchmark::State &state)
+{
+    run_benchmark_case<Program>(state, "benchmark/builtin_call_getattr.py",
+                                state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_BuiltinCallGetattr, CloverProgram)
+    ->Name("BM_BuiltinCallGetattr")
+    ->Arg(100000);
+
 template <typename Program> static void BM_GlobalWrite(benchmark::State &state)
 {
     run_benchmark_case<Program>(state, "benchmark/global_write.py",
@@ -1228,6 +1446,18 @@ BENCHMARK_TEMPLATE(BM_PystoneArithmetic, CloverProgram)
     ->Name("BM_PystoneArithmetic")
     ->Arg(10000);
 
+template <typename Program>
+static void BM_ThreadScaling(benchmark::State &state)
+{
+    run_benchmark_case<Program>(state, "benchmark/thread_scaling.py",
+                                state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_ThreadScaling, CloverProgram)
+    ->Name("BM_ThreadScaling")
+    ->RangeMultiplier(2)
+    ->Range(1, 8)
+    ->UseRealTime();
+
 int main(int argc, char **argv)
 {
     try
@@ -0,0 +1,7 @@
+def run(n):
+    # Two n-decimal-digit factors. Building them by repeated squaring is
+    # multiplication-bound too, so it stays inside the timed region.
+    left = 7 ** (n * 1183 // 1000)
+    right = 3 ** (n * 2096 // 1000)
+    product = left * right
+    return product % 1000000007
@@ -0,0 +1,107 @@
+#include "cpp_benchmarks.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace benchmark_cpp
+{
+    namespace
+    {
+        struct Point
+        {
+            int64_t x;
+        };
+    }  // namespace
+
+    int64_t builtin_call_len_run(int64_t n)
+    {
+        const std::vector<int64_t> values = {3, 5, 7};
+        const std::string name = "clover";
+        int64_t acc = 0;
+        for(int64_t i = 0; i < n; ++i)
+        {
+            acc += static_cast<int64_t>(values.size() + name.size());
+            preserve_benchmark_loop_value(acc);
+        }
+        return acc;
+    }
+
+    int64_t builtin_call_len_items(int64_t n) { return n; }
+
+    int64_t builtin_call_isinstance_run(int64_t n)
+    {
+        // The C++ type check is static, so only the counting loop remains.
+        int64_t acc = 0;
+        for(int64_t i = 0; i < n; ++i)
+        {
+            acc += 1;
+            preserve_benchmark_loop_value(acc);
+        }
+        return acc;
+    }
+
+    int64_t builtin_call_isinstance_items(int64_t n) { return n; }
+
+    int64_t builtin_call_hash_run(int64_t n)
+    {
+        const std::string key = "clover";
+        const size_t key_hash = std::hash<std::string>{}(key);
+        int64_t acc = 0;
+        for(int64_t i = 0; i < n; ++i)
+        {
+            acc += i;
+            if(std::hash<std::string>{}(key) == key_hash)
+            {
+                acc += 1;
+            }
+            preserve_benchmark_loop_value(acc);
+        }
+        return acc;
+    }
+
+    int64_t builtin_call_hash_items(int64_t n) { return n; }
+
+    int64_t builtin_call_abs_run(int64_t n)
+    {
+        int64_t acc = 0;
+        for(int64_t i = 0; i < n; ++i)
+        {
+            acc += std::llabs(3 - i);
+            preserve_benchmark_loop_value(acc);
+        }
+        return acc;
+    }
+
+    int64_t builtin_call_abs_items(int64_t n) { return n; }
+
+    int64_t builtin_call_min_max_run(int64_t n)
+    {
+        int64_t acc = 0;
+        for(int64_t i = 0; i < n; ++i)
+        {
+            acc += std::min<int64_t>(i, 50) + std::max<int64_t>(i, 50);
+            preserve_benchmark_loop_value(acc);
+        }
+        return acc;
+    }
+
+    int64_t builtin_call_min_max_items(int64_t n) { return n; }
+
+    int64_t builtin_call_getattr_run(int64_t n)
+    {
+        Point point{3};
+        int64_t acc = 0;
+        for(int64_t i = 0; i < n; ++i)
+        {
+            preserve_benchmark_loop_value(point);
+            acc += point.x + 1;
+            preserve_benchmark_loop_value(acc);
+        }
+        return acc;
+    }
+
+    int64_t builtin_call_getattr_items(int64_t n) { return n; }
+}  // namespace benchmark_cpp
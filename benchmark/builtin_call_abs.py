@@ -0,0 +1,7 @@
+def run(n):
+    acc = 0
+    i = 0
+    while i < n:
+        acc += abs(3 - i)
+        i += 1
+    return acc
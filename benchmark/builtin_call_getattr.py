@@ -0,0 +1,13 @@
+class Point:
+    def __init__(self, x):
+        self.x = x
+
+
+def run(n):
+    point = Point(3)
+    acc = 0
+    i = 0
+    while i < n:
+        acc += getattr(point, "x") + getattr(point, "y", 1)
+        i += 1
+    return acc
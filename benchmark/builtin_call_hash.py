@@ -0,0 +1,11 @@
+def run(n):
+    key = "clover"
+    key_hash = hash(key)
+    acc = 0
+    i = 0
+    while i < n:
+        acc += hash(i)
+        if hash(key) == key_hash:
+            acc += 1
+        i += 1
+    return acc
@@ -0,0 +1,9 @@
+def run(n):
+    value = 7
+    acc = 0
+    i = 0
+    while i < n:
+        if isinstance(value, int):
+            acc += 1
+        i += 1
+    return acc
@@ -0,0 +1,9 @@
+def run(n):
+    values = [3, 5, 7]
+    name = "clover"
+    acc = 0
+    i = 0
+    while i < n:
+        acc += len(values) + len(name)
+        i += 1
+    return acc
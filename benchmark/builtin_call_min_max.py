@@ -0,0 +1,7 @@
+def run(n):
+    acc = 0
+    i = 0
+    while i < n:
+        acc += min(i, 50) + max(i, 50)
+        i += 1
+    return acc
@@ -41,6 +41,9 @@ namespace benchmark_cpp
     int64_t str_constructor_int_run(int64_t n);
     int64_t str_constructor_int_items(int64_t n);
 
+    int64_t str_constructor_int_digits_run(int64_t n);
+    int64_t str_constructor_int_digits_items(int64_t n);
+
     int64_t str_constructor_string_run(int64_t n);
     int64_t str_constructor_string_items(int64_t n);
 
@@ -50,6 +53,18 @@ namespace benchmark_cpp
     int64_t int_constructor_string_run(int64_t n);
     int64_t int_constructor_string_items(int64_t n);
 
+    int64_t int_constructor_string_digits_run(int64_t n);
+    int64_t int_constructor_string_digits_items(int64_t n);
+
+    int64_t bigint_mul_run(int64_t n);
+    int64_t bigint_mul_items(int64_t n);
+
+    int64_t float_repr_run(int64_t n);
+    int64_t float_repr_items(int64_t n);
+
+    int64_t float_parse_run(int64_t n);
+    int64_t float_parse_items(int64_t n);
+
     int64_t while_loop_run(int64_t n);
     int64_t while_loop_items(int64_t n);
 
@@ -116,6 +131,9 @@ namespace benchmark_cpp
     int64_t exception_typed_handler_raise_run(int64_t n);
     int64_t exception_typed_handler_raise_items(int64_t n);
 
+    int64_t exception_deep_unwind_run(int64_t n);
+    int64_t exception_deep_unwind_items(int64_t n);
+
     int64_t class_instantiation_run(int64_t n);
     int64_t class_instantiation_items(int64_t n);
 
@@ -176,9 +194,36 @@ namespace benchmark_cpp
     int64_t global_read_run(int64_t n);
     int64_t global_read_items(int64_t n);
 
+    int64_t global_helper_call_run(int64_t n);
+    int64_t global_helper_call_items(int64_t n);
+
+    int64_t forwarding_wrapper_run(int64_t n);
+    int64_t forwarding_wrapper_items(int64_t n);
+
+    int64_t forwarding_wrapper_kwargs_run(int64_t n);
+    int64_t forwarding_wrapper_kwargs_items(int64_t n);
+
     int64_t builtin_lookup_run(int64_t n);
     int64_t builtin_lookup_items(int64_t n);
 
+    int64_t builtin_call_len_run(int64_t n);
+    int64_t builtin_call_len_items(int64_t n);
+
+    int64_t builtin_call_isinstance_run(int64_t n);
+    int64_t builtin_call_isinstance_items(int64_t n);
+
+    int64_t builtin_call_hash_run(int64_t n);
+    int64_t builtin_call_hash_items(int64_t n);
+
+    int64_t builtin_call_abs_run(int64_t n);
+    int64_t builtin_call_abs_items(int64_t n);
+
+    int64_t builtin_call_min_max_run(int64_t n);
+    int64_t builtin_call_min_max_items(int64_t n);
+
+    int64_t builtin_call_getattr_run(int64_t n);
+    int64_t builtin_call_getattr_items(int64_t n);
+
     int64_t global_write_run(int64_t n);
     int64_t global_write_items(int64_t n);
 
@@ -211,6 +256,9 @@ namespace benchmark_cpp
 
     int64_t pystone_arithmetic_run(int64_t n);
     int64_t pystone_arithmetic_items(int64_t n);
+
+    int64_t thread_scaling_run(int64_t n);
+    int64_t thread_scaling_items(int64_t n);
 }  // namespace benchmark_cpp
 
 #endif
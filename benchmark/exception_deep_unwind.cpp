@@ -0,0 +1,53 @@
+#include "cpp_benchmarks.h"
+
+#include <stdexcept>
+
+namespace benchmark_cpp
+{
+    namespace
+    {
+        int64_t descend(int64_t depth)
+        {
+            int64_t x = depth;
+            for(int64_t region = 0; region < 20; ++region)
+            {
+                try
+                {
+                    x += region + 1;
+                    preserve_benchmark_loop_value(x);
+                }
+                catch(const std::out_of_range &)
+                {
+                    x -= 1;
+                }
+            }
+            if(depth == 0)
+            {
+                throw std::runtime_error("benchmark exception");
+            }
+            return descend(depth - 1) + x;
+        }
+    }  // namespace
+
+    int64_t exception_deep_unwind_run(int64_t n)
+    {
+        int64_t acc = 0;
+        int64_t counter = 0;
+        while(counter < n)
+        {
+            try
+            {
+                preserve_benchmark_loop_value(descend(200));
+            }
+            catch(const std::runtime_error &)
+            {
+                acc += counter;
+            }
+            preserve_benchmark_loop_value(acc);
+            counter += 1;
+        }
+        return acc;
+    }
+
+    int64_t exception_deep_unwind_items(int64_t n) { return n; }
+}  // namespace benchmark_cpp
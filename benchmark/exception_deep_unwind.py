@@ -0,0 +1,97 @@
+def descend(depth):
+    x = depth
+    try:
+        x += 1
+    except KeyError:
+        x -= 1
+    try:
+        x += 2
+    except KeyError:
+        x -= 1
+    try:
+        x += 3
+    except KeyError:
+        x -= 1
+    try:
+        x += 4
+    except KeyError:
+        x -= 1
+    try:
+        x += 5
+    except KeyError:
+        x -= 1
+    try:
+        x += 6
+    except KeyError:
+        x -= 1
+    try:
+        x += 7
+    except KeyError:
+        x -= 1
+    try:
+        x += 8
+    except KeyError:
+        x -= 1
+    try:
+        x += 9
+    except KeyError:
+        x -= 1
+    try:
+        x += 10
+    except KeyError:
+        x -= 1
+    try:
+        x += 11
+    except KeyError:
+        x -= 1
+    try:
+        x += 12
+    except KeyError:
+        x -= 1
+    try:
+        x += 13
+    except KeyError:
+        x -= 1
+    try:
+        x += 14
+    except KeyError:
+        x -= 1
+    try:
+        x += 15
+    except KeyError:
+        x -= 1
+    try:
+        x += 16
+    except KeyError:
+        x -= 1
+    try:
+        x += 17
+    except KeyError:
+        x -= 1
+    try:
+        x += 18
+    except KeyError:
+        x -= 1
+    try:
+        x += 19
+    except KeyError:
+        x -= 1
+    try:
+        x += 20
+    except KeyError:
+        x -= 1
+    if depth == 0:
+        raise ValueError
+    return descend(depth - 1) + x
+
+
+def run(n):
+    acc = 0
+    counter = 0
+    while counter < n:
+        try:
+            descend(200)
+        except ValueError:
+            acc += counter
+        counter += 1
+    return acc
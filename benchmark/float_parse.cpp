@@ -0,0 +1,27 @@
+#include "cpp_benchmarks.h"
+
+#include <cstdlib>
+
+namespace benchmark_cpp
+{
+    int64_t float_parse_run(int64_t n)
+    {
+        static const char *const texts[] = {
+            "0.1",    "-2.5e-3", "3.141592653589793", "123456.789",
+            "6.02214076e23", "1e-300", " 42 ", "0.30000000000000004",
+        };
+        int64_t total = 0;
+        for(int64_t i = 0; i < n; ++i)
+        {
+            double value = std::strtod(texts[i % 8], nullptr);
+            preserve_benchmark_loop_value(value);
+            if(value > 1.0)
+            {
+                total += 1;
+            }
+        }
+        return total;
+    }
+
+    int64_t float_parse_items(int64_t n) { return n; }
+}  // namespace benchmark_cpp
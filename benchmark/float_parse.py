@@ -0,0 +1,17 @@
+def run(n):
+    texts = [
+        "0.1",
+        "-2.5e-3",
+        "3.141592653589793",
+        "123456.789",
+        "6.02214076e23",
+        "1e-300",
+        " 42 ",
+        "0.30000000000000004",
+    ]
+    total = 0
+    for i in range(n):
+        value = float(texts[i % 8])
+        if value > 1.0:
+            total += 1
+    return total
@@ -0,0 +1,68 @@
+#include "cpp_benchmarks.h"
+
+#include <charconv>
+#include <cstdlib>
+
+namespace benchmark_cpp
+{
+    namespace
+    {
+        // Length of CPython's repr(value) for a finite value: the shortest
+        // round-tripping digits in fixed notation while the decimal point
+        // lands in (-4, 16], in exponent notation otherwise.
+        int64_t python_float_repr_length(double value)
+        {
+            char text[32];
+            std::to_chars_result converted =
+                std::to_chars(text, text + sizeof(text) - 1, value,
+                              std::chars_format::scientific);
+            *converted.ptr = '\0';
+            int64_t length = 0;
+            const char *cursor = text;
+            if(*cursor == '-')
+            {
+                ++length;
+                ++cursor;
+            }
+            int64_t n_digits = 0;
+            for(; *cursor != 'e'; ++cursor)
+            {
+                n_digits += *cursor != '.';
+            }
+            int64_t exponent = std::strtol(cursor + 1, nullptr, 10);
+
+            int64_t decimal_point = exponent + 1;
+            if(decimal_point > -4 && decimal_point <= 16)
+            {
+                if(decimal_point <= 0)
+                {
+                    return length + 2 - decimal_point + n_digits;
+                }
+                if(decimal_point >= n_digits)
+                {
+                    return length + decimal_point + 2;
+                }
+                return length + n_digits + 1;
+            }
+            int64_t magnitude = exponent < 0 ? -exponent : exponent;
+            int64_t exponent_digits = magnitude >= 100 ? 3 : 2;
+            return length + n_digits + (n_digits > 1 ? 1 : 0) + 2 +
+                   exponent_digits;
+        }
+    }  // namespace
+
+    int64_t float_repr_run(int64_t n)
+    {
+        int64_t total = 0;
+        double value = 0.1;
+        for(int64_t i = 0; i < n; ++i)
+        {
+            total += python_float_repr_length(value);
+            preserve_benchmark_loop_value(total);
+            value = value * 1.0001 + 0.37;
+        }
+        return total;
+    }
+
+    int64_t float_repr_items(int64_t n) { return n; }
+}  // namespace benchmark_cpp
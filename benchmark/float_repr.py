@@ -0,0 +1,7 @@
+def run(n):
+    total = 0
+    value = 0.1
+    for _ in range(n):
+        total += len(repr(value))
+        value = value * 1.0001 + 0.37
+    return total
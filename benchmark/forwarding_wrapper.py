@@ -0,0 +1,13 @@
+def target(a, b):
+    return a + b
+
+
+def wrapper(*args):
+    return target(*args)
+
+
+def run(n):
+    acc = 0
+    for i in range(n):
+        acc += wrapper(i, 1)
+    return acc
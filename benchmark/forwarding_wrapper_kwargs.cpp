@@ -0,0 +1,30 @@
+#include "cpp_benchmarks.h"
+
+namespace benchmark_cpp
+{
+    namespace
+    {
+        int64_t target(int64_t a, int64_t b, int64_t scale)
+        {
+            return (a + b) * scale;
+        }
+
+        template <typename... Args> int64_t wrapper(Args... args)
+        {
+            return target(args...);
+        }
+    }  // namespace
+
+    int64_t forwarding_wrapper_kwargs_run(int64_t n)
+    {
+        int64_t acc = 0;
+        for(int64_t i = 0; i < n; ++i)
+        {
+            acc += wrapper(i, int64_t(1), int64_t(2));
+            preserve_benchmark_loop_value(acc);
+        }
+        return acc;
+    }
+
+    int64_t forwarding_wrapper_kwargs_items(int64_t n) { return n; }
+}  // namespace benchmark_cpp
@@ -0,0 +1,13 @@
+def target(a, b, scale=1):
+    return (a + b) * scale
+
+
+def wrapper(*args, **kwargs):
+    return target(*args, **kwargs)
+
+
+def run(n):
+    acc = 0
+    for i in range(n):
+        acc += wrapper(i, 1, scale=2)
+    return acc
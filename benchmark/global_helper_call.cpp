@@ -0,0 +1,22 @@
+#include "cpp_benchmarks.h"
+
+namespace benchmark_cpp
+{
+    namespace
+    {
+        int64_t bump(int64_t value) { return value + 1; }
+    }  // namespace
+
+    int64_t global_helper_call_run(int64_t n)
+    {
+        int64_t acc = 0;
+        for(int64_t i = 0; i < n; ++i)
+        {
+            acc += bump(i);
+            preserve_benchmark_loop_value(acc);
+        }
+        return acc;
+    }
+
+    int64_t global_helper_call_items(int64_t n) { return n; }
+}  // namespace benchmark_cpp
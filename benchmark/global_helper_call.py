@@ -0,0 +1,9 @@
+def bump(value):
+    return value + 1
+
+
+def run(n):
+    acc = 0
+    for i in range(n):
+        acc += bump(i)
+    return acc
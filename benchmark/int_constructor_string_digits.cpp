@@ -0,0 +1,22 @@
+#include "cpp_benchmarks.h"
+
+namespace benchmark_cpp
+{
+    // Reduces the decimal text modulo 1000000007 as it is read, so it only
+    // checks the result; the interesting comparison is against CPython.
+    int64_t int_constructor_string_digits_run(int64_t n)
+    {
+        static constexpr uint64_t kModulus = 1000000007;
+        static constexpr char kDigits[] = "1234567890";
+
+        uint64_t value = 0;
+        for(int64_t i = 0; i < n / 10 * 10; ++i)
+        {
+            value = (value * 10 + uint64_t(kDigits[i % 10] - '0')) % kModulus;
+            preserve_benchmark_loop_value(value);
+        }
+        return static_cast<int64_t>(value);
+    }
+
+    int64_t int_constructor_string_digits_items(int64_t n) { return n; }
+}  // namespace benchmark_cpp
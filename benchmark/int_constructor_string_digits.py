@@ -0,0 +1,11 @@
+import sys
+
+sys.set_int_max_str_digits(0)
+
+
+def run(n):
+    parts = []
+    for _ in range(n // 10):
+        parts.append("1234567890")
+    value = int("".join(parts))
+    return value % 1000000007
@@ -0,0 +1,181 @@
+#include <benchmark/benchmark.h>
+
+#include "cpp_benchmarks.h"
+#include <atomic>
+#include <cstdint>
+
+/*
+  Refcount update cost per mode, outside the interpreter. The VM picks one
+  mode at configure time (CLOVERVM_REFCOUNT_MODE), so these loops replay the
+  header traffic of global_refcounted_write.py and
+  instance_attribute_refcounted_write.py under all three modes in one binary:
+  each store increfs the new value and decrefs the old one. BiasedForeign
+  runs the biased mode from a thread that does not own the objects.
+*/
+
+namespace
+{
+    thread_local uint32_t current_owner = 1;
+
+    struct Header
+    {
+        int32_t refcount = 1;
+        uint32_t owner_thread = 1;
+        int32_t shared_refcount = 0;
+    };
+
+    struct PlainRefcount
+    {
+        static void incref(Header *obj) { ++obj->refcount; }
+        static bool decref(Header *obj) { return --obj->refcount == 0; }
+    };
+
+    struct AtomicRefcount
+    {
+        static void incref(Header *obj)
+        {
+            std::atomic_ref<int32_t>(obj->refcount)
+                .fetch_add(1, std::memory_order_relaxed);
+        }
+        static bool decref(Header *obj)
+        {
+            return std::atomic_ref<int32_t>(obj->refcount)
+                       .fetch_sub(1, std::memory_order_acq_rel) == 1;
+        }
+    };
+
+    struct BiasedRefcount
+    {
+        static void incref(Header *obj)
+        {
+            if(obj->owner_thread == current_owner)
+            {
+                ++obj->refcount;
+            }
+            else
+            {
+                std::atomic_ref<int32_t>(obj->shared_refcount)
+                    .fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+        static bool decref(Header *obj)
+        {
+            if(obj->owner_thread == current_owner)
+            {
+                return --obj->refcount == 0 &&
+                       std::atomic_ref<int32_t>(obj->shared_refcount)
+                               .load(std::memory_order_acquire) == 0;
+            }
+            std::atomic_ref<int32_t>(obj->shared_refcount)
+                .fetch_sub(1, std::memory_order_acq_rel);
+            return false;
+        }
+    };
+
+    struct BiasedForeignRefcount : BiasedRefcount
+    {
+    };
+
+    template <typename Mode> struct OwnerScope
+    {
+    };
+
+    template <> struct OwnerScope<BiasedForeignRefcount>
+    {
+        OwnerScope() { current_owner = 2; }
+        ~OwnerScope() { current_owner = 1; }
+    };
+
+    template <typename Mode>
+    int64_t store_slot(Header **slot, Header *value, int64_t zero_count)
+    {
+        Mode::incref(value);
+        Header *old = *slot;
+        *slot = value;
+        return zero_count + (Mode::decref(old) ? 1 : 0);
+    }
+
+    Header *global_slot = nullptr;
+
+    template <typename Mode>
+    void BM_RefcountModeGlobalWrite(benchmark::State &state)
+    {
+        [[maybe_unused]] OwnerScope<Mode> owner;
+        Header a;
+        Header b;
+        Header initial;
+        int64_t n = state.range(0);
+        for(auto _: state)
+        {
+            global_slot = &initial;
+            ++initial.refcount;
+            int64_t zero_count = 0;
+            for(int64_t i = 0; i < n; ++i)
+            {
+                zero_count = store_slot<Mode>(&global_slot, &a, zero_count);
+                zero_count = store_slot<Mode>(&global_slot, &b, zero_count);
+                benchmark_cpp::preserve_benchmark_loop_value(global_slot);
+            }
+            benchmark::DoNotOptimize(zero_count);
+        }
+        state.SetItemsProcessed(state.iterations() * n);
+    }
+
+    struct Holder
+    {
+        Header header;
+        Header *value = nullptr;
+    };
+
+    template <typename Mode>
+    void BM_RefcountModeInstanceAttributeWrite(benchmark::State &state)
+    {
+        [[maybe_unused]] OwnerScope<Mode> owner;
+        Holder obj;
+        Header a;
+        Header b;
+        Header initial;
+        int64_t n = state.range(0);
+        for(auto _: state)
+        {
+            obj.value = &initial;
+            ++initial.refcount;
+            int64_t zero_count = 0;
+            for(int64_t i = 0; i < n; ++i)
+            {
+                zero_count = store_slot<Mode>(&obj.value, &a, zero_count);
+                zero_count = store_slot<Mode>(&obj.value, &b, zero_count);
+                benchmark_cpp::preserve_benchmark_loop_value(obj);
+            }
+            benchmark::DoNotOptimize(zero_count);
+        }
+        state.SetItemsProcessed(state.iterations() * n);
+    }
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_RefcountModeGlobalWrite, PlainRefcount)
+    ->Name("BM_RefcountModeGlobalWrite/plain")
+    ->Arg(100000);
+BENCHMARK_TEMPLATE(BM_RefcountModeGlobalWrite, AtomicRefcount)
+    ->Name("BM_RefcountModeGlobalWrite/atomic")
+    ->Arg(100000);
+BENCHMARK_TEMPLATE(BM_RefcountModeGlobalWrite, BiasedRefcount)
+    ->Name("BM_RefcountModeGlobalWrite/biased")
+    ->Arg(100000);
+BENCHMARK_TEMPLATE(BM_RefcountModeGlobalWrite, BiasedForeignRefcount)
+    ->Name("BM_RefcountModeGlobalWrite/biased_foreign")
+    ->Arg(100000);
+
+BENCHMARK_TEMPLATE(BM_RefcountModeInstanceAttributeWrite, PlainRefcount)
+    ->Name("BM_RefcountModeInstanceAttributeWrite/plain")
+    ->Arg(100000);
+BENCHMARK_TEMPLATE(BM_RefcountModeInstanceAttributeWrite, AtomicRefcount)
+    ->Name("BM_RefcountModeInstanceAttributeWrite/atomic")
+    ->Arg(100000);
+BENCHMARK_TEMPLATE(BM_RefcountModeInstanceAttributeWrite, BiasedRefcount)
+    ->Name("BM_RefcountModeInstanceAttributeWrite/biased")
+    ->Arg(100000);
+BENCHMARK_TEMPLATE(BM_RefcountModeInstanceAttributeWrite,
+                   BiasedForeignRefcount)
+    ->Name("BM_RefcountModeInstanceAttributeWrite/biased_foreign")
+    ->Arg(100000);
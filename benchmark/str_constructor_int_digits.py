@@ -0,0 +1,9 @@
+import sys
+
+sys.set_int_max_str_digits(0)
+
+
+def run(n):
+    value = 7 ** (n * 1183 // 1000)
+    text = str(value)
+    return len(text)
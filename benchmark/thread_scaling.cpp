@@ -0,0 +1,26 @@
+#include "cpp_benchmarks.h"
+
+namespace benchmark_cpp
+{
+    namespace
+    {
+        constexpr int64_t kThreadScalingIterations = 2000;
+    }  // namespace
+
+    // The C++ baseline runs the per-thread workload serially, so vs_cpp shows
+    // how far threaded Python is from the single-core native cost.
+    int64_t thread_scaling_run(int64_t n)
+    {
+        int64_t total = 0;
+        for(int64_t idx = 0; idx < n; ++idx)
+        {
+            total += pystone_lite_run(kThreadScalingIterations);
+        }
+        return total;
+    }
+
+    int64_t thread_scaling_items(int64_t n)
+    {
+        return n * kThreadScalingIterations;
+    }
+}  // namespace benchmark_cpp
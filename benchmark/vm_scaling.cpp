@@ -0,0 +1,90 @@
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <clovervm/clovervm.h>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+/*
+  Embedding throughput versus VM count. Each benchmark thread owns one
+  clover_vm and runs the same precompiled module body, the way a server runs
+  one isolated VM per worker. Items are module runs across all VMs.
+*/
+
+namespace
+{
+    constexpr const char *kVmScalingSource = "def work(n):\n"
+                                             "    total = 0\n"
+                                             "    for i in range(n):\n"
+                                             "        total += i * i % 7\n"
+                                             "    return total\n"
+                                             "\n"
+                                             "result = work(5000)\n";
+    constexpr int kCallsPerIteration = 8;
+
+    struct VmWorker
+    {
+        clover_vm *vm = nullptr;
+        clover_code *code = nullptr;
+    };
+
+    void BM_VmScaling(benchmark::State &state)
+    {
+        size_t vm_count = static_cast<size_t>(state.range(0));
+        std::vector<VmWorker> workers(vm_count);
+        for(VmWorker &worker: workers)
+        {
+            worker.vm = clover_vm_new();
+            worker.code =
+                clover_vm_compile(worker.vm, kVmScalingSource, nullptr);
+            if(worker.code == nullptr)
+            {
+                throw std::runtime_error("failed to compile vm scaling source");
+            }
+        }
+
+        std::atomic<bool> failed = false;
+        for(auto _: state)
+        {
+            std::vector<std::thread> threads;
+            threads.reserve(vm_count);
+            for(VmWorker &worker: workers)
+            {
+                threads.emplace_back([&worker, &failed] {
+                    for(int call = 0; call < kCallsPerIteration; ++call)
+                    {
+                        if(clover_vm_call(worker.vm, worker.code) !=
+                           CLOVER_STATUS_OK)
+                        {
+                            failed.store(true, std::memory_order_relaxed);
+                        }
+                    }
+                });
+            }
+            for(std::thread &thread: threads)
+            {
+                thread.join();
+            }
+            if(failed.load(std::memory_order_relaxed))
+            {
+                state.SkipWithError("vm scaling source raised an exception");
+                break;
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * vm_count *
+                                kCallsPerIteration);
+
+        for(VmWorker &worker: workers)
+        {
+            clover_code_destroy(worker.code);
+            clover_vm_destroy(worker.vm);
+        }
+    }
+}  // namespace
+
+BENCHMARK(BM_VmScaling)
+    ->Name("BM_VmScaling")
+    ->RangeMultiplier(2)
+    ->Range(1, 8)
+    ->UseRealTime();
@@ -0,0 +1,89 @@
+#include <benchmark/benchmark.h>
+
+#include <clovervm/clovervm.h>
+#include <stdexcept>
+#include <sys/wait.h>
+#include <unistd.h>
+
+/*
+  Time to a ready VM, the way a request server would get one. Cold start
+  builds a fresh clover_vm, imports the warm-up modules, and runs the request
+  body. Fork warm start imports once in the parent, calls
+  clover_vm_prepare_fork, and then forks a child per request that runs the
+  precompiled body against the inherited heap. Items are requests served.
+*/
+
+namespace
+{
+    constexpr const char *kWarmupSource = "import os\n"
+                                          "import threading\n"
+                                          "import string\n"
+                                          "import glob\n";
+    constexpr const char *kRequestSource =
+        "import os\n"
+        "import string\n"
+        "result = os.path.join('srv', string.ascii_lowercase[:4])\n";
+
+    void BM_VmColdStart(benchmark::State &state)
+    {
+        for(auto _: state)
+        {
+            clover_vm *vm = clover_vm_new();
+            bool ok =
+                clover_vm_run_string(vm, kWarmupSource, 0) == CLOVER_STATUS_OK &&
+                clover_vm_run_string(vm, kRequestSource, 0) ==
+                    CLOVER_STATUS_OK;
+            clover_vm_destroy(vm);
+            if(!ok)
+            {
+                state.SkipWithError("cold start source raised an exception");
+                break;
+            }
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    void BM_VmForkWarmStart(benchmark::State &state)
+    {
+        clover_vm *vm = clover_vm_new();
+        if(clover_vm_run_string(vm, kWarmupSource, 0) != CLOVER_STATUS_OK)
+        {
+            throw std::runtime_error("failed to run vm startup warm-up");
+        }
+        clover_code *code = clover_vm_compile(vm, kRequestSource, nullptr);
+        if(code == nullptr ||
+           clover_vm_prepare_fork(vm) != CLOVER_STATUS_OK)
+        {
+            throw std::runtime_error("failed to prepare vm startup snapshot");
+        }
+
+        for(auto _: state)
+        {
+            pid_t pid = fork();
+            if(pid == 0)
+            {
+                _exit(clover_vm_call(vm, code) == CLOVER_STATUS_OK ? 0 : 1);
+            }
+            int status = 0;
+            if(pid == -1 || waitpid(pid, &status, 0) != pid ||
+               !WIFEXITED(status) || WEXITSTATUS(status) != 0)
+            {
+                state.SkipWithError("forked request failed");
+                break;
+            }
+        }
+        state.SetItemsProcessed(state.iterations());
+
+        clover_code_destroy(code);
+        clover_vm_destroy(vm);
+    }
+}  // namespace
+
+BENCHMARK(BM_VmColdStart)
+    ->Name("BM_VmColdStart")
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+BENCHMARK(BM_VmForkWarmStart)
+    ->Name("BM_VmForkWarmStart")
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
@@ -7,8 +7,12 @@
 #   should force a decision about whether it belongs to embedders, extensions,
 #   both, or neither.
 set(CLOVERVM_EMBEDDER_API_SYMBOLS
+    clover_code_destroy
+    clover_vm_call
+    clover_vm_compile
     clover_vm_destroy
     clover_vm_new
+    clover_vm_prepare_fork
     clover_vm_run_file
     clover_vm_run_interactive
     clover_vm_run_string
@@ -26,6 +30,7 @@ set(CLOVERVM_EXTENSION_MODULE_BUILDER_API_SYMBOLS
     clover_module_add_value)
 
 set(CLOVERVM_EXTENSION_RUNTIME_API_SYMBOLS
+    clover_begin_blocking
     clover_dict_check
     clover_dict_check_exact
     clover_dict_clear
@@ -47,6 +52,7 @@ set(CLOVERVM_EXTENSION_RUNTIME_API_SYMBOLS
     clover_dict_set_item_string
     clover_dict_size
     clover_dict_values
+    clover_end_blocking
     clover_float_as_double
     clover_float_from_double
     clover_int_from_int64
@@ -22,7 +22,12 @@ extern "C"
         CLOVER_STATUS_ERROR = -1,
     } clover_status;
 
+    // Each clover_vm is isolated: different VMs may run at the same time on
+    // different OS threads. One VM must only be entered by one host thread at
+    // a time.
     typedef struct clover_vm clover_vm;
+    // A compiled __main__ module body, owned by the VM that compiled it.
+    typedef struct clover_code clover_code;
 
     CL_EXPORT clover_vm *clover_vm_new(void);
     CL_EXPORT void clover_vm_destroy(clover_vm *vm);
@@ -35,6 +40,22 @@ extern "C"
     CL_EXPORT clover_status clover_vm_run_interactive(clover_vm *vm,
                                                       int print_bytecode);
 
+    // Compiles source once so it can be run many times. filename may be NULL.
+    // Returns NULL after printing the error. Destroy the code before its VM.
+    CL_EXPORT clover_code *clover_vm_compile(clover_vm *vm, const char *source,
+                                             const char *filename);
+    // Runs a compiled module body. Each call executes it again in the same
+    // module namespace.
+    CL_EXPORT clover_status clover_vm_call(clover_vm *vm, clover_code *code);
+    CL_EXPORT void clover_code_destroy(clover_code *code);
+
+    // Readies a warm VM to be inherited by fork(): reclaims dead objects and
+    // checks that no Python-started thread is still running. The child
+    // shares the parent's heap pages copy-on-write and can use the VM and its
+    // compiled code at once. Call from the host thread that owns the VM,
+    // outside any VM call; fails after printing the reason.
+    CL_EXPORT clover_status clover_vm_prepare_fork(clover_vm *vm);
+
 #ifdef __cplusplus
 }
 #endif
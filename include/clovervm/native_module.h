@@ -197,6 +197,11 @@ extern "C"
                                                      const char *utf8_message);
     CL_EXPORT clover_handle clover_propagate_error(clover_context *ctx);
 
+    // Brackets a blocking wait that does not touch Clover values, such as a
+    // sleep or a read from a file descriptor, so other threads may run.
+    CL_EXPORT void clover_begin_blocking(clover_context *ctx);
+    CL_EXPORT void clover_end_blocking(clover_context *ctx);
+
 #ifdef __cplusplus
 }
 #endif
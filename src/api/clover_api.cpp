@@ -7,6 +7,7 @@
 #include "cli/repl.h"
 #include "compiler/parser.h"
 #include "compiler/source_text.h"
+#include "object_model/refcount.h"
 #include "object_model/typed_value.h"
 #include "object_model/value.h"
 #include "runtime/exception_object.h"
@@ -22,6 +23,12 @@ struct clover_vm
     cl::VirtualMachine vm;
 };
 
+struct clover_code
+{
+    clover_vm *owner;
+    cl::CodeObject *code;
+};
+
 namespace
 {
     std::optional<std::wstring> decode_api_string(const char *str)
@@ -62,6 +69,15 @@ namespace
         return result;
     }
 
+    // Narrow UTF-8 output: a wide write would fix stderr's orientation and
+    // silently drop the host's later narrow writes.
+    void print_pending_python_exception(cl::ThreadState *thread)
+    {
+        std::cerr << cl::unicode::encode_utf8(
+                         format_pending_python_exception(thread))
+                  << "\n";
+    }
+
     clover_status run_code_object(cl::ThreadState *thread, cl::CodeObject *code,
                                   bool print_bytecode)
     {
@@ -73,7 +89,7 @@ namespace
         cl::Value result = thread->run_clovervm_code_object(code);
         if(result.is_exception_marker())
         {
-            std::wcerr << format_pending_python_exception(thread) << L"\n";
+            print_pending_python_exception(thread);
             return CLOVER_STATUS_ERROR;
         }
         return CLOVER_STATUS_OK;
@@ -108,7 +124,7 @@ namespace
             file_contents->c_str(), cl::StartRule::File, filename->c_str());
         if(code.has_exception())
         {
-            std::wcerr << format_pending_python_exception(thread) << L"\n";
+            print_pending_python_exception(thread);
             return CLOVER_STATUS_ERROR;
         }
         return run_code_object(thread, code.value(), print_bytecode);
@@ -134,11 +150,86 @@ namespace
             thread->compile(source_text->c_str(), cl::StartRule::File);
         if(code.has_exception())
         {
-            std::wcerr << format_pending_python_exception(thread) << L"\n";
+            print_pending_python_exception(thread);
             return CLOVER_STATUS_ERROR;
         }
         return run_code_object(thread, code.value(), print_bytecode);
     }
+
+    clover_code *compile_impl(clover_vm *api_vm, const char *source,
+                              const char *filename)
+    {
+        if(api_vm == nullptr)
+        {
+            std::cerr << "clover_vm_compile called with null vm\n";
+            return nullptr;
+        }
+
+        std::optional<std::wstring> source_text = decode_api_string(source);
+        if(!source_text.has_value())
+        {
+            std::cerr << "failed to decode source string\n";
+            return nullptr;
+        }
+        std::optional<std::wstring> main_file;
+        if(filename != nullptr)
+        {
+            main_file = decode_api_string(filename);
+            if(!main_file.has_value())
+            {
+                std::cerr << "failed to decode source filename\n";
+                return nullptr;
+            }
+        }
+
+        cl::ThreadState *thread = api_vm->vm.get_default_thread();
+        cl::ThreadState::ActivationScope activation_scope(thread);
+        cl::Expected<cl::CodeObject *> code =
+            main_file.has_value()
+                ? thread->compile(source_text->c_str(), cl::StartRule::File,
+                                  main_file->c_str())
+                : thread->compile(source_text->c_str(), cl::StartRule::File);
+        if(code.has_exception())
+        {
+            print_pending_python_exception(thread);
+            return nullptr;
+        }
+        // The handle holds a heap reference so reclamation between calls
+        // cannot free the code object.
+        return new clover_code{api_vm, cl::incref(code.value())};
+    }
+
+    clover_status call_impl(clover_vm *api_vm, clover_code *code)
+    {
+        if(api_vm == nullptr || code == nullptr)
+        {
+            std::cerr << "clover_vm_call called with null vm or code\n";
+            return CLOVER_STATUS_ERROR;
+        }
+        if(code->owner != api_vm)
+        {
+            std::cerr << "clover_vm_call called with code from another vm\n";
+            return CLOVER_STATUS_ERROR;
+        }
+        return run_code_object(api_vm->vm.get_default_thread(), code->code,
+                               false);
+    }
+
+    clover_status prepare_fork_impl(clover_vm *api_vm)
+    {
+        if(api_vm == nullptr)
+        {
+            std::cerr << "clover_vm_prepare_fork called with null vm\n";
+            return CLOVER_STATUS_ERROR;
+        }
+        if(!api_vm->vm.prepare_for_fork())
+        {
+            std::cerr << "clover_vm_prepare_fork: Python threads are still "
+                         "running\n";
+            return CLOVER_STATUS_ERROR;
+        }
+        return CLOVER_STATUS_OK;
+    }
 }  // namespace
 
 extern "C"
@@ -185,4 +276,32 @@ extern "C"
                    : CLOVER_STATUS_ERROR;
     }
 
+    CL_EXPORT clover_code *clover_vm_compile(clover_vm *vm, const char *source,
+                                             const char *filename)
+    {
+        return compile_impl(vm, source, filename);
+    }
+
+    CL_EXPORT clover_status clover_vm_call(clover_vm *vm, clover_code *code)
+    {
+        return call_impl(vm, code);
+    }
+
+    CL_EXPORT void clover_code_destroy(clover_code *code)
+    {
+        if(code == nullptr)
+        {
+            return;
+        }
+        cl::ThreadState::ActivationScope activation_scope(
+            code->owner->vm.get_default_thread());
+        cl::decref(code->code);
+        delete code;
+    }
+
+    CL_EXPORT clover_status clover_vm_prepare_fork(clover_vm *vm)
+    {
+        return prepare_fork_impl(vm);
+    }
+
 }  // extern "C"
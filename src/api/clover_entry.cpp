@@ -64,7 +64,9 @@ namespace cl
             CL_TRY(handler.resolve());
             CL_TRY(code.emit_return_exception_marker_to_native(0));
         }
-        return code.finalize();
+        CodeObject *adapter = CL_TRY(code.finalize());
+        adapter->hide_from_traceback = true;
+        return Expected<CodeObject *>::ok(adapter);
     }
 
 }  // namespace cl
@@ -158,8 +158,7 @@ extern "C" CL_EXPORT clover_handle clover_int_from_int64(clover_context *ctx,
 extern "C" CL_EXPORT clover_handle clover_float_from_double(clover_context *ctx,
                                                             double value)
 {
-    return cl::allocate_handle(
-        ctx, ctx->thread->make_object_value<cl::Float>(value).raw_value());
+    return cl::allocate_handle(ctx, cl::box_float(ctx->thread, value));
 }
 
 extern "C" CL_EXPORT clover_handle
@@ -357,9 +356,9 @@ extern "C" CL_EXPORT clover_status clover_float_as_double(clover_context *ctx,
         return CLOVER_STATUS_OK;
     }
 
-    if(cl::can_convert_to<cl::Float>(unwrapped))
+    if(cl::is_float_value(unwrapped))
     {
-        *out = unwrapped.get_ptr<cl::Float>()->value();
+        *out = cl::float_value(unwrapped);
         return CLOVER_STATUS_OK;
     }
 
@@ -827,3 +826,13 @@ extern "C" CL_EXPORT clover_handle clover_propagate_error(clover_context *ctx)
 {
     return cl::allocate_handle(ctx, cl::Value::exception_marker());
 }
+
+extern "C" CL_EXPORT void clover_begin_blocking(clover_context *ctx)
+{
+    ctx->thread->begin_blocking();
+}
+
+extern "C" CL_EXPORT void clover_end_blocking(clover_context *ctx)
+{
+    ctx->thread->end_blocking();
+}
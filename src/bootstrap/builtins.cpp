@@ -1,5 +1,6 @@
 #include "bootstrap/builtins.h"
 
+#include "builtin_types/float.h"
 #include "builtin_types/list.h"
 #include "builtin_types/module_object.h"
 #include "builtin_types/str.h"
@@ -13,6 +14,7 @@
 #include "runtime/exception_propagation.h"
 #include "runtime/thread_state.h"
 #include "runtime/virtual_machine.h"
+#include "util/fixed_wide_string.h"
 #include <algorithm>
 #include <cassert>
 #include <string>
@@ -120,6 +122,18 @@ namespace cl
         return result;
     }
 
+    static Value builtin_getattr_or_default(ThreadState *thread, Value obj,
+                                            Value name, Value default_value)
+    {
+        CL_PROPAGATE_EXCEPTION(require_attribute_name(name));
+        Value result = load_attr(obj, TValue<String>::from_value_assumed(name));
+        if(result.is_not_present())
+        {
+            return default_value;
+        }
+        return result;
+    }
+
     static Value builtin_getattr_default(ThreadState *thread, Value obj,
                                          Value name, Value default_tuple)
     {
@@ -131,18 +145,12 @@ namespace cl
             return active_thread()->set_pending_builtin_exception_none(
                 L"TypeError");
         }
-
-        Value result = load_attr(obj, TValue<String>::from_value_assumed(name));
-        if(result.is_not_present())
+        if(defaults->empty())
         {
-            if(defaults->empty())
-            {
-                return active_thread()->set_pending_builtin_exception_string(
-                    L"AttributeError", L"object has no such attribute");
-            }
-            return defaults->item_unchecked(0);
+            return builtin_getattr(thread, obj, name);
         }
-        return result;
+        return builtin_getattr_or_default(thread, obj, name,
+                                          defaults->item_unchecked(0));
     }
 
     static Value builtin_hasattr(ThreadState *thread, Value obj, Value name)
@@ -309,6 +317,244 @@ namespace cl
         return Value::from_oop(list);
     }
 
+    // Builtin function specializations. Protocol builtins forward to the
+    // trusted handler of the special method their complete implementation
+    // would call; the others share their native operation with the complete
+    // path. See doc/function-specialization.md.
+
+    // Special-method lookup is only stable for classes whose MRO up to the
+    // defining class is immutable.
+    static Value lookup_immutable_class_special_method(ClassObject *cls,
+                                                       TValue<String> name)
+    {
+        Tuple *mro = assume_convert_to<Tuple>(cls->get_mro_value());
+        for(size_t idx = 0; idx < mro->size(); ++idx)
+        {
+            ClassObject *mro_class =
+                assume_convert_to<ClassObject>(mro->item_unchecked(idx));
+            if(!mro_class->get_shape()->has_flag(ShapeFlag::IsImmutable))
+            {
+                return Value::not_present();
+            }
+            Value method = mro_class->get_own_property(name);
+            if(!method.is_not_present())
+            {
+                return method;
+            }
+        }
+        return Value::not_present();
+    }
+
+    template <FixedWideString MethodName>
+    class SpecialMethodSpecializationResolver final
+        : public TrustedHandlerResolverBase<>
+    {
+    public:
+        static constexpr uint8_t prefix_length = 1;
+
+        static TrustedResolution resolve(VirtualMachine *vm, uint32_t n_args,
+                                         ShapeKey receiver_key,
+                                         ShapeKey operand1_key)
+        {
+            (void)operand1_key;
+            if(n_args != 1)
+            {
+                return TrustedResolution::no_trusted_handler_call_untrusted();
+            }
+
+            ClassObject *cls = vm->shape_for_key(receiver_key)->get_class();
+            Value method = lookup_immutable_class_special_method(
+                cls, vm->get_or_create_interned_string_value(
+                         MethodName.c_str()));
+            if(!can_convert_to<Function>(method))
+            {
+                return TrustedResolution::no_trusted_handler_call_untrusted();
+            }
+            CodeObject *code_object =
+                method.get_ptr<Function>()->code_object.extract();
+            if(code_object->trusted_handler_resolver == nullptr)
+            {
+                return TrustedResolution::no_trusted_handler_call_untrusted();
+            }
+            TrustedResolution resolution =
+                code_object->trusted_handler_resolver(
+                    vm, receiver_key, ShapeKey::from_value(Value::not_present()),
+                    TrustedHandlerOperandOrder::Normal,
+                    TrustedHandlerArity::Unary);
+            if(!resolution.has_trusted_handler())
+            {
+                return TrustedResolution::no_trusted_handler_call_untrusted();
+            }
+            return resolution;
+        }
+    };
+
+    using IsInstanceHandler =
+        TrustedHandlerDefinition<builtin_isinstance,
+                                 TrustedHandlerEffects::Raise>;
+
+    // isinstance is a single native operation, so the specialization only
+    // removes the synthetic frame and guards no argument shapes.
+    class IsInstanceSpecializationResolver final
+        : public TrustedHandlerResolverBase<IsInstanceHandler>
+    {
+    public:
+        static constexpr uint8_t prefix_length = 0;
+
+        static TrustedResolution resolve(VirtualMachine *vm, uint32_t n_args,
+                                         ShapeKey operand0_key,
+                                         ShapeKey operand1_key)
+        {
+            (void)vm;
+            (void)operand0_key;
+            (void)operand1_key;
+            if(n_args != 2)
+            {
+                return TrustedResolution::no_trusted_handler_call_untrusted();
+            }
+            return Handler<0>::resolution();
+        }
+    };
+
+    using GetattrHandler =
+        TrustedHandlerDefinition<builtin_getattr,
+                                 TrustedHandlerEffects::Allocate |
+                                     TrustedHandlerEffects::Raise>;
+    using GetattrOrDefaultHandler =
+        TrustedHandlerDefinition<builtin_getattr_or_default,
+                                 TrustedHandlerEffects::Allocate |
+                                     TrustedHandlerEffects::Raise>;
+
+    // getattr takes its default through *default, so the specialization
+    // selects the target from the call-site argument count instead.
+    class GetattrSpecializationResolver final
+        : public TrustedHandlerResolverBase<GetattrHandler,
+                                            GetattrOrDefaultHandler>
+    {
+    public:
+        static constexpr uint8_t prefix_length = 0;
+
+        static TrustedResolution resolve(VirtualMachine *vm, uint32_t n_args,
+                                         ShapeKey operand0_key,
+                                         ShapeKey operand1_key)
+        {
+            (void)vm;
+            (void)operand0_key;
+            (void)operand1_key;
+            if(n_args == 2)
+            {
+                return Handler<0>::resolution();
+            }
+            if(n_args == 3)
+            {
+                return Handler<1>::resolution();
+            }
+            return TrustedResolution::no_trusted_handler_call_untrusted();
+        }
+    };
+
+    // Two-argument min and max return the first argument unless the second
+    // compares strictly smaller (or larger), matching the loop in builtins.py.
+    template <bool IsMax>
+    static Value specialized_smi_min_max(ThreadState *thread, Value first,
+                                         Value second)
+    {
+        (void)thread;
+        int64_t first_value = first.get_smi();
+        int64_t second_value = second.get_smi();
+        bool take_second = IsMax ? second_value > first_value
+                                 : second_value < first_value;
+        return take_second ? second : first;
+    }
+
+    template <bool IsMax>
+    static Value specialized_float_min_max(ThreadState *thread, Value first,
+                                           Value second)
+    {
+        (void)thread;
+        double first_value = float_value(first);
+        double second_value = float_value(second);
+        bool take_second = IsMax ? second_value > first_value
+                                 : second_value < first_value;
+        return take_second ? second : first;
+    }
+
+    template <bool IsMax>
+    inline constexpr TrustedHandlerSemantics min_max_semantics =
+        IsMax ? TrustedHandlerSemantics::Max : TrustedHandlerSemantics::Min;
+
+    template <bool IsMax>
+    using SmiMinMaxHandler =
+        TrustedHandlerDefinition<specialized_smi_min_max<IsMax>,
+                                 TrustedHandlerEffects::None,
+                                 min_max_semantics<IsMax>>;
+
+    template <bool IsMax>
+    using FloatMinMaxHandler =
+        TrustedHandlerDefinition<specialized_float_min_max<IsMax>,
+                                 TrustedHandlerEffects::None,
+                                 min_max_semantics<IsMax>>;
+
+    template <bool IsMax>
+    class MinMaxSpecializationResolver final
+        : public TrustedHandlerResolverBase<SmiMinMaxHandler<IsMax>,
+                                            FloatMinMaxHandler<IsMax>>
+    {
+    public:
+        static constexpr uint8_t prefix_length = 2;
+
+        static TrustedResolution resolve(VirtualMachine *vm, uint32_t n_args,
+                                         ShapeKey operand0_key,
+                                         ShapeKey operand1_key)
+        {
+            if(n_args != 2)
+            {
+                return TrustedResolution::no_trusted_handler_call_untrusted();
+            }
+            ShapeKey smi_key = ShapeKey::from_value(Value::from_smi(0));
+            if(operand0_key == smi_key && operand1_key == smi_key)
+            {
+                return SmiMinMaxHandler<IsMax>::resolution();
+            }
+            if(is_exact_float_shape_key(vm, operand0_key) &&
+               is_exact_float_shape_key(vm, operand1_key))
+            {
+                return FloatMinMaxHandler<IsMax>::resolution();
+            }
+            return TrustedResolution::no_trusted_handler_call_untrusted();
+        }
+    };
+
+    template <typename Resolver>
+    static void install_builtin_specialization(VirtualMachine *vm,
+                                               const wchar_t *name)
+    {
+        Value function =
+            vm->global_builtins_module().extract()->get_own_property(
+                vm->get_or_create_interned_string_value(name));
+        assert(can_convert_to<Function>(function));
+        install_function_specialization_resolver<Resolver>(
+            *vm, *function.get_ptr<Function>()->code_object.extract());
+    }
+
+    void install_builtin_function_specializations(VirtualMachine *vm)
+    {
+        install_builtin_specialization<
+            SpecialMethodSpecializationResolver<L"__len__">>(vm, L"len");
+        install_builtin_specialization<
+            SpecialMethodSpecializationResolver<L"__hash__">>(vm, L"hash");
+        install_builtin_specialization<
+            SpecialMethodSpecializationResolver<L"__abs__">>(vm, L"abs");
+        install_builtin_specialization<IsInstanceSpecializationResolver>(
+            vm, L"isinstance");
+        install_builtin_specialization<GetattrSpecializationResolver>(
+            vm, L"getattr");
+        install_builtin_specialization<MinMaxSpecializationResolver<false>>(
+            vm, L"min");
+        install_builtin_specialization<MinMaxSpecializationResolver<true>>(
+            vm, L"max");
+    }
+
     static void install_builtin_function_binding(VirtualMachine *vm,
                                                  const wchar_t *name,
                                                  Value value)
@@ -8,6 +8,9 @@ namespace cl
     class VirtualMachine;
 
     Expected<void> install_builtin_function_bindings(VirtualMachine *vm);
+    // Attaches function specialization resolvers to builtin functions. Runs
+    // after trusted builtins.py has defined the Python-level builtins.
+    void install_builtin_function_specializations(VirtualMachine *vm);
 }  // namespace cl
 
 #endif  // CL_BUILTINS_H
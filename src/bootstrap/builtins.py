@@ -52,6 +52,13 @@ def len(obj):
     )
 
 
+def abs(x):
+    """Return the absolute value of the argument."""
+    return __clover_call_special__(
+        x, "__abs__", TypeError, "bad operand type for abs()"
+    )
+
+
 def getattr(obj, name, *default):
     """Return the named attribute from an object.
 
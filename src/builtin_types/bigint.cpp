@@ -9,8 +9,10 @@
 #include <cfloat>
 #include <cmath>
 #include <cstring>
+#include <iterator>
 #include <limits>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace cl
@@ -673,6 +675,183 @@ namespace cl
         bigint_add_into(dest, left, negated_right);
     }
 
+    // Operand lengths, in digits, at which multiplication moves from the
+    // schoolbook loop to Karatsuba and from Karatsuba to Toom-3. Both apply
+    // to the shorter operand. Tuned with the BM_BigIntMul benchmarks.
+    static constexpr size_t kKaratsubaThresholdDigits = 32;
+    static constexpr size_t kToom3ThresholdDigits = 256;
+
+    static void bigint_abs_mul_schoolbook(digit_t *dest, const digit_t *left,
+                                          size_t left_n, const digit_t *right,
+                                          size_t right_n)
+    {
+        std::fill_n(dest, left_n + right_n, digit_t{0});
+        for(size_t left_idx = 0; left_idx < left_n; ++left_idx)
+        {
+            double_digit_t carry = 0;
+            for(size_t right_idx = 0; right_idx < right_n; ++right_idx)
+            {
+                size_t dest_idx = left_idx + right_idx;
+                double_digit_t product = double_digit_t(left[left_idx]) *
+                                             right[right_idx] +
+                                         dest[dest_idx] + carry;
+                dest[dest_idx] = static_cast<digit_t>(product);
+                carry = product >> kDigitBits;
+            }
+            dest[left_idx + right_n] = static_cast<digit_t>(carry);
+        }
+    }
+
+    // dest[0..dest_n) += src[0..src_n). The sum must fit in dest_n digits.
+    static void bigint_digits_add_in_place(digit_t *dest, size_t dest_n,
+                                           const digit_t *src, size_t src_n)
+    {
+        assert(src_n <= dest_n);
+        double_digit_t carry = 0;
+        size_t idx = 0;
+        for(; idx < src_n; ++idx)
+        {
+            double_digit_t sum = double_digit_t(dest[idx]) + src[idx] + carry;
+            dest[idx] = static_cast<digit_t>(sum);
+            carry = sum >> kDigitBits;
+        }
+        for(; carry != 0; ++idx)
+        {
+            assert(idx < dest_n);
+            double_digit_t sum = double_digit_t(dest[idx]) + carry;
+            dest[idx] = static_cast<digit_t>(sum);
+            carry = sum >> kDigitBits;
+        }
+    }
+
+    // dest[0..dest_n) -= src[0..src_n). dest must not be smaller than src.
+    static void bigint_digits_sub_in_place(digit_t *dest, size_t dest_n,
+                                           const digit_t *src, size_t src_n)
+    {
+        assert(src_n <= dest_n);
+        digit_t borrow = 0;
+        size_t idx = 0;
+        for(; idx < src_n; ++idx)
+        {
+            double_digit_t subtrahend = double_digit_t(src[idx]) + borrow;
+            borrow = dest[idx] < subtrahend ? 1 : 0;
+            dest[idx] = static_cast<digit_t>(dest[idx] - subtrahend);
+        }
+        for(; borrow != 0; ++idx)
+        {
+            assert(idx < dest_n);
+            borrow = dest[idx] == 0 ? 1 : 0;
+            --dest[idx];
+        }
+    }
+
+    // dest[0..max(left_n, right_n) + 1) = left + right.
+    static size_t bigint_digits_add(digit_t *dest, const digit_t *left,
+                                    size_t left_n, const digit_t *right,
+                                    size_t right_n)
+    {
+        if(left_n < right_n)
+        {
+            std::swap(left, right);
+            std::swap(left_n, right_n);
+        }
+        std::memcpy(dest, left, left_n * sizeof(digit_t));
+        dest[left_n] = 0;
+        bigint_digits_add_in_place(dest, left_n + 1, right, right_n);
+        return left_n + 1;
+    }
+
+    // Scratch digits needed by bigint_abs_mul_digits() when the longer
+    // operand has n digits. Each Karatsuba or chunking level uses at most
+    // 2n + 6 digits and hands at most n / 2 + 2 digits to the next level.
+    static size_t bigint_abs_mul_scratch_digits(size_t n)
+    {
+        size_t total = 0;
+        while(n >= kKaratsubaThresholdDigits)
+        {
+            total += 2 * n + 6;
+            n = n / 2 + 2;
+        }
+        return total;
+    }
+
+    static void bigint_abs_mul_toom3(digit_t *dest, const digit_t *left,
+                                     size_t left_n, const digit_t *right,
+                                     size_t right_n);
+
+    // dest[0..left_n + right_n) = left * right over raw magnitudes. The
+    // operands may carry leading zero digits and must not alias dest or
+    // scratch.
+    static void bigint_abs_mul_digits(digit_t *dest, const digit_t *left,
+                                      size_t left_n, const digit_t *right,
+                                      size_t right_n, digit_t *scratch)
+    {
+        if(left_n < right_n)
+        {
+            std::swap(left, right);
+            std::swap(left_n, right_n);
+        }
+        assert(right_n > 0);
+
+        if(right_n < kKaratsubaThresholdDigits)
+        {
+            bigint_abs_mul_schoolbook(dest, left, left_n, right, right_n);
+            return;
+        }
+
+        if(2 * right_n <= left_n)
+        {
+            // Unbalanced: multiply right by right_n-digit chunks of left.
+            size_t total_n = left_n + right_n;
+            std::fill_n(dest, total_n, digit_t{0});
+            digit_t *product = scratch;
+            scratch += 2 * right_n;
+            for(size_t offset = 0; offset < left_n; offset += right_n)
+            {
+                size_t chunk_n = std::min(right_n, left_n - offset);
+                bigint_abs_mul_digits(product, left + offset, chunk_n, right,
+                                      right_n, scratch);
+                bigint_digits_add_in_place(dest + offset, total_n - offset,
+                                           product, chunk_n + right_n);
+            }
+            return;
+        }
+
+        if(right_n >= kToom3ThresholdDigits && right_n > 2 * ((left_n + 2) / 3))
+        {
+            bigint_abs_mul_toom3(dest, left, left_n, right, right_n);
+            return;
+        }
+
+        // Karatsuba: with x = B^m, (a1 x + a0)(b1 x + b0) is
+        // z2 x^2 + ((a0 + a1)(b0 + b1) - z0 - z2) x + z0.
+        size_t m = left_n / 2;
+        const digit_t *a1 = left + m;
+        const digit_t *b1 = right + m;
+        size_t a1_n = left_n - m;
+        size_t b1_n = right_n - m;
+        bigint_abs_mul_digits(dest, left, m, right, m, scratch);
+        bigint_abs_mul_digits(dest + 2 * m, a1, a1_n, b1, b1_n, scratch);
+
+        digit_t *a_sum = scratch;
+        size_t a_sum_n = bigint_digits_add(a_sum, left, m, a1, a1_n);
+        digit_t *b_sum = a_sum + a_sum_n;
+        size_t b_sum_n = bigint_digits_add(b_sum, right, m, b1, b1_n);
+        digit_t *middle = b_sum + b_sum_n;
+        size_t middle_n = a_sum_n + b_sum_n;
+        bigint_abs_mul_digits(middle, a_sum, a_sum_n, b_sum, b_sum_n,
+                              middle + middle_n);
+        bigint_digits_sub_in_place(middle, middle_n, dest, 2 * m);
+        bigint_digits_sub_in_place(middle, middle_n, dest + 2 * m,
+                                   a1_n + b1_n);
+        while(middle_n > 0 && middle[middle_n - 1] == 0)
+        {
+            --middle_n;
+        }
+        bigint_digits_add_in_place(dest + m, left_n + right_n - m, middle,
+                                   middle_n);
+    }
+
     static void bigint_mul_into(MutableBigIntView *dest, ConstBigIntView left,
                                 ConstBigIntView right)
     {
@@ -689,23 +868,11 @@ namespace cl
 
         size_t result_capacity = left.n_digits + right.n_digits;
         assert(dest->capacity >= result_capacity);
-        std::fill_n(dest->digits, result_capacity, digit_t{0});
-
-        for(size_t left_idx = 0; left_idx < left.n_digits; ++left_idx)
-        {
-            double_digit_t carry = 0;
-            for(size_t right_idx = 0; right_idx < right.n_digits; ++right_idx)
-            {
-                size_t dest_idx = left_idx + right_idx;
-                double_digit_t product = double_digit_t(left.digits[left_idx]) *
-                                             right.digits[right_idx] +
-                                         dest->digits[dest_idx] + carry;
-                dest->digits[dest_idx] = static_cast<digit_t>(product);
-                carry = product >> kDigitBits;
-            }
-            dest->digits[left_idx + right.n_digits] =
-                static_cast<digit_t>(carry);
-        }
+        BigIntScratch scratch(bigint_abs_mul_scratch_digits(
+            std::max(left.n_digits, right.n_digits)));
+        bigint_abs_mul_digits(dest->digits, left.digits, left.n_digits,
+                              right.digits, right.n_digits,
+                              scratch.mutable_view().digits);
 
         dest->n_digits = result_capacity;
         dest->signum = left.signum * right.signum;
@@ -1046,6 +1213,146 @@ namespace cl
         dest->signum = normalized.signum == 0 ? 0 : 1;
     }
 
+    static ConstBigIntView bigint_digit_span_view(const digit_t *digits,
+                                                  size_t n_digits)
+    {
+        return normalize_bigint_view(
+            ConstBigIntView{n_digits, signum_t{1}, digits});
+    }
+
+    static void bigint_work_add(BigIntWorkBuffer *dest, ConstBigIntView left,
+                                ConstBigIntView right)
+    {
+        dest->ensure_capacity(std::max(left.n_digits, right.n_digits) + 1);
+        bigint_add_into(dest->mutable_view(), left, right);
+    }
+
+    static void bigint_work_sub(BigIntWorkBuffer *dest, ConstBigIntView left,
+                                ConstBigIntView right)
+    {
+        dest->ensure_capacity(std::max(left.n_digits, right.n_digits) + 1);
+        bigint_sub_into(dest->mutable_view(), left, right);
+    }
+
+    static void bigint_work_mul(BigIntWorkBuffer *dest, ConstBigIntView left,
+                                ConstBigIntView right)
+    {
+        dest->ensure_capacity(left.n_digits + right.n_digits);
+        bigint_mul_into(dest->mutable_view(), left, right);
+    }
+
+    static void bigint_work_shift_left(BigIntWorkBuffer *dest,
+                                       ConstBigIntView src,
+                                       uint64_t shift_amount)
+    {
+        dest->ensure_capacity(src.n_digits + shift_amount / kDigitBits + 1);
+        bigint_shift_left_into(dest->mutable_view(), src, shift_amount);
+    }
+
+    // dest = src / divisor for a signed src that divisor divides exactly.
+    static void bigint_work_exact_div(BigIntWorkBuffer *dest,
+                                      ConstBigIntView src, uint32_t divisor)
+    {
+        dest->ensure_capacity(src.n_digits);
+        MutableBigIntView *quotient = dest->mutable_view();
+        uint32_t remainder =
+            divmod_abs_by_u32(quotient, abs_bigint_view(src), divisor);
+        assert(remainder == 0);
+        (void)remainder;
+        if(quotient->signum != 0)
+        {
+            quotient->signum = src.signum;
+        }
+    }
+
+    struct BigIntToom3Points
+    {
+        BigIntWorkBuffer at_one;
+        BigIntWorkBuffer at_minus_one;
+        BigIntWorkBuffer at_minus_two;
+    };
+
+    // Evaluates p0 + p1 x + p2 x^2 at 1, -1 and -2.
+    static void bigint_toom3_evaluate(BigIntToom3Points *points,
+                                      ConstBigIntView p0, ConstBigIntView p1,
+                                      ConstBigIntView p2)
+    {
+        BigIntWorkBuffer even_sum;
+        BigIntWorkBuffer temporary;
+        bigint_work_add(&even_sum, p0, p2);
+        bigint_work_add(&points->at_one, even_sum.view(), p1);
+        bigint_work_sub(&points->at_minus_one, even_sum.view(), p1);
+        bigint_work_add(&temporary, points->at_minus_one.view(), p2);
+        bigint_work_shift_left(&even_sum, temporary.view(), 1);
+        bigint_work_sub(&points->at_minus_two, even_sum.view(), p0);
+    }
+
+    // Toom-3 on balanced operands, evaluating at 0, 1, -1, -2 and infinity
+    // and interpolating with Bodrato's sequence. Pointwise products recurse
+    // through bigint_mul_into().
+    static void bigint_abs_mul_toom3(digit_t *dest, const digit_t *left,
+                                     size_t left_n, const digit_t *right,
+                                     size_t right_n)
+    {
+        size_t k = (left_n + 2) / 3;
+        assert(right_n > 2 * k);
+        ConstBigIntView a0 = bigint_digit_span_view(left, k);
+        ConstBigIntView a1 = bigint_digit_span_view(left + k, k);
+        ConstBigIntView a2 =
+            bigint_digit_span_view(left + 2 * k, left_n - 2 * k);
+        ConstBigIntView b0 = bigint_digit_span_view(right, k);
+        ConstBigIntView b1 = bigint_digit_span_view(right + k, k);
+        ConstBigIntView b2 =
+            bigint_digit_span_view(right + 2 * k, right_n - 2 * k);
+
+        BigIntToom3Points a_points;
+        BigIntToom3Points b_points;
+        bigint_toom3_evaluate(&a_points, a0, a1, a2);
+        bigint_toom3_evaluate(&b_points, b0, b1, b2);
+
+        BigIntWorkBuffer r0;
+        BigIntWorkBuffer r1;
+        BigIntWorkBuffer r2;
+        BigIntWorkBuffer r3;
+        BigIntWorkBuffer r4;
+        BigIntWorkBuffer at_minus_one;
+        BigIntWorkBuffer at_minus_two;
+        bigint_work_mul(&r0, a0, b0);
+        bigint_work_mul(&r1, a_points.at_one.view(), b_points.at_one.view());
+        bigint_work_mul(&at_minus_one, a_points.at_minus_one.view(),
+                        b_points.at_minus_one.view());
+        bigint_work_mul(&at_minus_two, a_points.at_minus_two.view(),
+                        b_points.at_minus_two.view());
+        bigint_work_mul(&r4, a2, b2);
+
+        BigIntWorkBuffer temporary;
+        bigint_work_sub(&temporary, at_minus_two.view(), r1.view());
+        bigint_work_exact_div(&r3, temporary.view(), 3);
+        bigint_work_sub(&temporary, r1.view(), at_minus_one.view());
+        bigint_work_exact_div(&r1, temporary.view(), 2);
+        bigint_work_sub(&r2, at_minus_one.view(), r0.view());
+        bigint_work_sub(&temporary, r2.view(), r3.view());
+        bigint_work_exact_div(&at_minus_two, temporary.view(), 2);
+        bigint_work_shift_left(&temporary, r4.view(), 1);
+        bigint_work_add(&r3, at_minus_two.view(), temporary.view());
+        bigint_work_add(&temporary, r2.view(), r1.view());
+        bigint_work_sub(&r2, temporary.view(), r4.view());
+        bigint_work_sub(&temporary, r1.view(), r3.view());
+        r1.swap(temporary);
+
+        size_t total_n = left_n + right_n;
+        std::fill_n(dest, total_n, digit_t{0});
+        BigIntWorkBuffer *coefficients[] = {&r0, &r1, &r2, &r3, &r4};
+        for(size_t idx = 0; idx < std::size(coefficients); ++idx)
+        {
+            ConstBigIntView coefficient = coefficients[idx]->view();
+            assert(coefficient.signum >= 0);
+            bigint_digits_add_in_place(dest + idx * k, total_n - idx * k,
+                                       coefficient.digits,
+                                       coefficient.n_digits);
+        }
+    }
+
     static bool bigint_abs_shift_right_loses_nonzero_bits(ConstBigIntView src,
                                                           uint64_t shift_amount)
     {
@@ -1162,10 +1469,10 @@ namespace cl
         remainder->signum = normalized_remainder.signum == 0 ? 0 : 1;
     }
 
-    static void bigint_abs_divmod_into(MutableBigIntView *quotient,
-                                       MutableBigIntView *remainder,
-                                       ConstBigIntView dividend,
-                                       ConstBigIntView divisor)
+    static void bigint_abs_divmod_knuth_into(MutableBigIntView *quotient,
+                                             MutableBigIntView *remainder,
+                                             ConstBigIntView dividend,
+                                             ConstBigIntView divisor)
     {
         assert(is_normalized_bigint_view(dividend));
         assert(is_normalized_bigint_view(divisor));
@@ -1231,6 +1538,216 @@ namespace cl
                                     normalization_shift);
     }
 
+    // Divisor and quotient length, in digits, from which division recurses
+    // with Burnikel-Ziegler instead of running Knuth's algorithm D.
+    static constexpr size_t kRecursiveDivisionThresholdDigits = 64;
+
+    static ConstBigIntView bigint_digits_above_view(ConstBigIntView view,
+                                                    size_t n_digits)
+    {
+        if(view.n_digits <= n_digits)
+        {
+            return ConstBigIntView{0, 0, view.digits};
+        }
+        return ConstBigIntView{view.n_digits - n_digits, view.signum,
+                               view.digits + n_digits};
+    }
+
+    // dest = high * B^width + (src / B^offset) mod B^width for nonnegative
+    // high and src.
+    static void bigint_work_shift_in(BigIntWorkBuffer *dest,
+                                     ConstBigIntView high, ConstBigIntView src,
+                                     size_t offset, size_t width)
+    {
+        dest->ensure_capacity(high.n_digits + width);
+        MutableBigIntView *view = dest->mutable_view();
+        std::fill_n(view->digits, width, digit_t{0});
+        if(src.n_digits > offset)
+        {
+            std::memcpy(view->digits, src.digits + offset,
+                        std::min(width, src.n_digits - offset) *
+                            sizeof(digit_t));
+        }
+        if(high.n_digits != 0)
+        {
+            std::memcpy(view->digits + width, high.digits,
+                        high.n_digits * sizeof(digit_t));
+        }
+        view->n_digits = high.n_digits + width;
+        view->signum = 1;
+        ConstBigIntView normalized = normalize_bigint_view(view->view());
+        view->n_digits = normalized.n_digits;
+        view->signum = normalized.signum;
+    }
+
+    static void bigint_divide_2n_by_1n(BigIntWorkBuffer *quotient,
+                                       BigIntWorkBuffer *remainder,
+                                       ConstBigIntView dividend,
+                                       ConstBigIntView divisor, size_t n);
+
+    // Divides a12 * B^n + a3 by divisor = b1 * B^n + b2, where a3 is digits
+    // [a3_offset, a3_offset + n) of a3_src and a12 / B^n <= b1.
+    static void bigint_divide_3n_by_2n(BigIntWorkBuffer *quotient,
+                                       BigIntWorkBuffer *remainder,
+                                       ConstBigIntView a12,
+                                       ConstBigIntView a3_src,
+                                       size_t a3_offset,
+                                       ConstBigIntView divisor,
+                                       ConstBigIntView b1, ConstBigIntView b2,
+                                       size_t n)
+    {
+        BigIntWorkBuffer temporary;
+        if(compare_bigint(bigint_digits_above_view(a12, n), b1) == 0)
+        {
+            // The quotient estimate saturates at B^n - 1, leaving
+            // a12 - b1 * B^n + b1 as the partial remainder.
+            quotient->ensure_capacity(n);
+            MutableBigIntView *all_ones = quotient->mutable_view();
+            std::fill_n(all_ones->digits, n, ~digit_t{0});
+            all_ones->n_digits = n;
+            all_ones->signum = 1;
+            bigint_work_shift_in(&temporary, ConstBigIntView{0, 0, nullptr},
+                                 a12, 0, n);
+            bigint_work_add(remainder, temporary.view(), b1);
+        }
+        else
+        {
+            bigint_divide_2n_by_1n(quotient, remainder, a12, b1, n);
+        }
+
+        BigIntWorkBuffer product;
+        bigint_work_shift_in(&temporary, remainder->view(), a3_src, a3_offset,
+                             n);
+        bigint_work_mul(&product, quotient->view(), b2);
+        bigint_work_sub(remainder, temporary.view(), product.view());
+
+        // A normalized divisor leaves at most two corrections.
+        digit_t one_digit = 1;
+        ConstBigIntView one{1, 1, &one_digit};
+        while(remainder->view().signum < 0)
+        {
+            bigint_work_sub(&temporary, quotient->view(), one);
+            quotient->swap(temporary);
+            bigint_work_add(&temporary, remainder->view(), divisor);
+            remainder->swap(temporary);
+        }
+    }
+
+    // Divides dividend < B^n * divisor by a normalized divisor of exactly n
+    // digits, so the quotient fits in n digits.
+    static void bigint_divide_2n_by_1n(BigIntWorkBuffer *quotient,
+                                       BigIntWorkBuffer *remainder,
+                                       ConstBigIntView dividend,
+                                       ConstBigIntView divisor, size_t n)
+    {
+        assert(divisor.n_digits == n);
+        if(n % 2 != 0 || n < kRecursiveDivisionThresholdDigits)
+        {
+            quotient->ensure_capacity(dividend.n_digits + 1);
+            remainder->ensure_capacity(dividend.n_digits + 1);
+            bigint_abs_divmod_knuth_into(quotient->mutable_view(),
+                                         remainder->mutable_view(), dividend,
+                                         divisor);
+            return;
+        }
+
+        size_t half = n / 2;
+        ConstBigIntView b1 = bigint_digits_above_view(divisor, half);
+        ConstBigIntView b2 = bigint_digit_span_view(divisor.digits, half);
+        BigIntWorkBuffer high_quotient;
+        BigIntWorkBuffer partial_remainder;
+        bigint_divide_3n_by_2n(&high_quotient, &partial_remainder,
+                               bigint_digits_above_view(dividend, n), dividend,
+                               half, divisor, b1, b2, half);
+        BigIntWorkBuffer low_quotient;
+        bigint_divide_3n_by_2n(&low_quotient, remainder,
+                               partial_remainder.view(), dividend, 0, divisor,
+                               b1, b2, half);
+        bigint_work_shift_in(quotient, high_quotient.view(),
+                             low_quotient.view(), 0, half);
+    }
+
+    // Burnikel-Ziegler division. The divisor is scaled to j * 2^k digits with
+    // its top bit set, so every recursive split stays even until it reaches
+    // Knuth's algorithm, and the dividend is consumed in blocks of that size.
+    static void bigint_abs_divmod_recursive_into(MutableBigIntView *quotient,
+                                                 MutableBigIntView *remainder,
+                                                 ConstBigIntView dividend,
+                                                 ConstBigIntView divisor)
+    {
+        size_t block_factor = 1;
+        while(block_factor * kRecursiveDivisionThresholdDigits <=
+              divisor.n_digits)
+        {
+            block_factor *= 2;
+        }
+        size_t n = (divisor.n_digits + block_factor - 1) / block_factor *
+                   block_factor;
+        uint64_t normalization_shift =
+            uint64_t(n - divisor.n_digits) * kDigitBits +
+            countl_zero(divisor.digits[divisor.n_digits - 1]);
+
+        BigIntWorkBuffer scaled_divisor;
+        BigIntWorkBuffer scaled_dividend;
+        bigint_work_shift_left(&scaled_divisor, divisor, normalization_shift);
+        bigint_work_shift_left(&scaled_dividend, dividend, normalization_shift);
+        ConstBigIntView b = scaled_divisor.view();
+        ConstBigIntView a = scaled_dividend.view();
+        assert(b.n_digits == n);
+
+        size_t n_blocks = (a.n_digits + n - 1) / n;
+        BigIntWorkBuffer scaled_quotient(n_blocks * n);
+        MutableBigIntView *quotient_digits = scaled_quotient.mutable_view();
+        std::fill_n(quotient_digits->digits, n_blocks * n, digit_t{0});
+        BigIntWorkBuffer partial_remainder;
+        BigIntWorkBuffer block_dividend;
+        BigIntWorkBuffer block_quotient;
+        BigIntWorkBuffer block_remainder;
+        for(size_t block = n_blocks; block > 0; --block)
+        {
+            size_t offset = (block - 1) * n;
+            bigint_work_shift_in(&block_dividend, partial_remainder.view(), a,
+                                 offset, n);
+            bigint_divide_2n_by_1n(&block_quotient, &block_remainder,
+                                   block_dividend.view(), b, n);
+            ConstBigIntView block_digits = block_quotient.view();
+            if(block_digits.n_digits != 0)
+            {
+                std::memcpy(quotient_digits->digits + offset,
+                            block_digits.digits,
+                            block_digits.n_digits * sizeof(digit_t));
+            }
+            partial_remainder.swap(block_remainder);
+        }
+        quotient_digits->n_digits = n_blocks * n;
+        quotient_digits->signum = 1;
+        ConstBigIntView normalized_quotient =
+            normalize_bigint_view(quotient_digits->view());
+        copy_bigint_view(quotient, normalized_quotient);
+
+        BigIntWorkBuffer unscaled_remainder(partial_remainder.n_digits());
+        bigint_shift_right_abs_into(unscaled_remainder.mutable_view(),
+                                    partial_remainder.view(),
+                                    normalization_shift);
+        copy_bigint_view(remainder, unscaled_remainder.view());
+    }
+
+    static void bigint_abs_divmod_into(MutableBigIntView *quotient,
+                                       MutableBigIntView *remainder,
+                                       ConstBigIntView dividend,
+                                       ConstBigIntView divisor)
+    {
+        if(divisor.n_digits >= kRecursiveDivisionThresholdDigits &&
+           dividend.n_digits >=
+               divisor.n_digits + kRecursiveDivisionThresholdDigits)
+        {
+            bigint_abs_divmod_recursive_into(quotient, remainder, dividend,
+                                             divisor);
+            return;
+        }
+        bigint_abs_divmod_knuth_into(quotient, remainder, dividend, divisor);
+    }
+
     struct BigIntDivModViews
     {
         ConstBigIntView quotient;
@@ -1793,53 +2310,206 @@ namespace cl
         return static_cast<uint32_t>(remainder);
     }
 
-    std::wstring bigint_to_decimal_string(ConstBigIntView view)
+    static constexpr uint32_t kDecimalChunkBase = 1000000000;
+    static constexpr size_t kDecimalChunkDigits = 9;
+    // Below these sizes decimal conversion runs the quadratic chunk loops;
+    // above them it splits on cached powers of 10^9 so the work is dominated
+    // by subquadratic multiplication and division.
+    static constexpr size_t kDecimalFormatThresholdDigits = 64;
+    static constexpr size_t kDecimalParseThresholdChars = 1024;
+
+    // 10^(9 * 2^level), built by repeated squaring and kept for the duration
+    // of one conversion.
+    class BigIntDecimalPowers
     {
-        static constexpr uint32_t kDecimalBase = 1000000000;
-        static constexpr uint32_t kDecimalBaseDigits = 9;
+    public:
+        ConstBigIntView power(size_t level)
+        {
+            while(powers_.size() <= level)
+            {
+                BigIntWorkBuffer next;
+                if(powers_.empty())
+                {
+                    MutableBigIntView *base = next.mutable_view();
+                    base->digits[0] = kDecimalChunkBase;
+                    base->n_digits = 1;
+                    base->signum = 1;
+                }
+                else
+                {
+                    bigint_work_mul(&next, powers_.back().view(),
+                                    powers_.back().view());
+                }
+                powers_.push_back(std::move(next));
+            }
+            return powers_[level].view();
+        }
+
+    private:
+        std::vector<BigIntWorkBuffer> powers_;
+    };
+
+    // Writes magnitude right-aligned into out[0, width), which the caller
+    // has already filled with '0'.
+    static void bigint_write_decimal_chunks(wchar_t *out, size_t width,
+                                            ConstBigIntView magnitude)
+    {
+        BigIntWorkBuffer current;
+        current.copy_from(magnitude);
+        BigIntWorkBuffer quotient(magnitude.n_digits);
+        size_t chunk_end = width;
+        while(current.n_digits() != 0)
+        {
+            uint32_t chunk = divmod_abs_by_u32(
+                quotient.mutable_view(), current.view(), kDecimalChunkBase);
+            size_t pos = chunk_end;
+            while(chunk != 0)
+            {
+                assert(pos > 0);
+                out[--pos] = static_cast<wchar_t>(L'0' + chunk % 10);
+                chunk /= 10;
+            }
+            chunk_end -= std::min(chunk_end, kDecimalChunkDigits);
+            current.swap(quotient);
+        }
+    }
+
+    // Writes magnitude < power(level)^2 right-aligned into
+    // out[0, 9 * 2^(level + 1)).
+    static void bigint_write_decimal(wchar_t *out, ConstBigIntView magnitude,
+                                     BigIntDecimalPowers *powers, size_t level)
+    {
+        size_t half_width = kDecimalChunkDigits << level;
+        if(magnitude.n_digits < kDecimalFormatThresholdDigits)
+        {
+            bigint_write_decimal_chunks(out, 2 * half_width, magnitude);
+            return;
+        }
+
+        assert(level > 0);
+        BigIntWorkBuffer quotient(magnitude.n_digits + 1);
+        BigIntWorkBuffer remainder(magnitude.n_digits + 1);
+        bigint_abs_divmod_into(quotient.mutable_view(),
+                               remainder.mutable_view(), magnitude,
+                               powers->power(level));
+        bigint_write_decimal(out, quotient.view(), powers, level - 1);
+        bigint_write_decimal(out + half_width, remainder.view(), powers,
+                             level - 1);
+    }
 
+    std::wstring bigint_to_decimal_string(ConstBigIntView view)
+    {
         assert(is_normalized_bigint_view(view));
         if(view.signum == 0)
         {
             return L"0";
         }
 
-        ConstBigIntView current{view.n_digits, 1, view.digits};
-        BigIntScratch scratch0(view.n_digits);
-        BigIntScratch scratch1(view.n_digits);
-        bool use_first_scratch = true;
-        std::vector<uint32_t> chunks;
-        chunks.reserve(size_t(view.n_digits) * 10 / kDecimalBaseDigits + 1);
-
-        while(current.n_digits > 0)
+        ConstBigIntView magnitude = abs_bigint_view(view);
+        std::wstring digits;
+        if(magnitude.n_digits < kDecimalFormatThresholdDigits)
         {
-            MutableBigIntView quotient = use_first_scratch
-                                             ? scratch0.mutable_view()
-                                             : scratch1.mutable_view();
-            uint32_t remainder =
-                divmod_abs_by_u32(&quotient, current, kDecimalBase);
-            chunks.push_back(remainder);
-            current = quotient.view();
-            use_first_scratch = !use_first_scratch;
+            digits.assign(magnitude.n_digits * 10, L'0');
+            bigint_write_decimal_chunks(digits.data(), digits.size(),
+                                        magnitude);
         }
+        else
+        {
+            BigIntDecimalPowers powers;
+            size_t level = 0;
+            while(2 * powers.power(level).n_digits - 2 < magnitude.n_digits)
+            {
+                ++level;
+            }
+            digits.assign(kDecimalChunkDigits << (level + 1), L'0');
+            bigint_write_decimal(digits.data(), magnitude, &powers, level);
+        }
+        size_t first_nonzero = digits.find_first_not_of(L'0');
+        assert(first_nonzero != std::wstring::npos);
 
         std::wstring result;
-        result.reserve(chunks.size() * kDecimalBaseDigits +
-                       (view.signum < 0 ? 1 : 0));
+        result.reserve(digits.size() - first_nonzero + 1);
         if(view.signum < 0)
         {
             result.push_back(L'-');
         }
+        result.append(digits, first_nonzero);
+        return result;
+    }
+
+    static void bigint_parse_decimal_chunks(BigIntWorkBuffer *dest,
+                                            std::string_view digits)
+    {
+        static constexpr uint32_t kChunkMultipliers[] = {
+            1,      10,      100,      1000,      10000,
+            100000, 1000000, 10000000, 100000000, 1000000000};
 
-        result += std::to_wstring(chunks.back());
-        for(size_t chunk_index = chunks.size() - 1; chunk_index > 0;
-            --chunk_index)
+        size_t capacity = digits.size() / kDecimalChunkDigits + 2;
+        dest->ensure_capacity(capacity);
+        set_zero(dest->mutable_view());
+        BigIntWorkBuffer next(capacity);
+        size_t chunk_size = digits.size() % kDecimalChunkDigits;
+        if(chunk_size == 0)
         {
-            std::wstring chunk = std::to_wstring(chunks[chunk_index - 1]);
-            result.append(kDecimalBaseDigits - chunk.size(), L'0');
-            result += chunk;
+            chunk_size = kDecimalChunkDigits;
         }
-        return result;
+        for(size_t pos = 0; pos < digits.size();)
+        {
+            uint32_t chunk = 0;
+            for(size_t idx = 0; idx < chunk_size; ++idx)
+            {
+                assert(digits[pos + idx] >= '0' && digits[pos + idx] <= '9');
+                chunk = chunk * 10 + uint32_t(digits[pos + idx] - '0');
+            }
+            bigint_abs_mul_add_u32(next.mutable_view(), dest->view(),
+                                   kChunkMultipliers[chunk_size], chunk);
+            dest->swap(next);
+            pos += chunk_size;
+            chunk_size = kDecimalChunkDigits;
+        }
+    }
+
+    static void bigint_parse_decimal(BigIntWorkBuffer *dest,
+                                     std::string_view digits,
+                                     BigIntDecimalPowers *powers)
+    {
+        if(digits.size() <= kDecimalParseThresholdChars)
+        {
+            bigint_parse_decimal_chunks(dest, digits);
+            return;
+        }
+
+        size_t level = 0;
+        while((kDecimalChunkDigits << (level + 1)) < digits.size())
+        {
+            ++level;
+        }
+        size_t low_size = kDecimalChunkDigits << level;
+        BigIntWorkBuffer high;
+        BigIntWorkBuffer low;
+        BigIntWorkBuffer scaled_high;
+        bigint_parse_decimal(&high, digits.substr(0, digits.size() - low_size),
+                             powers);
+        bigint_parse_decimal(&low, digits.substr(digits.size() - low_size),
+                             powers);
+        bigint_work_mul(&scaled_high, high.view(), powers->power(level));
+        bigint_work_add(dest, scaled_high.view(), low.view());
+    }
+
+    Expected<Value> bigint_from_decimal_digits(ThreadState *thread,
+                                               std::string_view digits,
+                                               signum_t signum)
+    {
+        assert(signum == 1 || signum == -1);
+        BigIntDecimalPowers powers;
+        BigIntWorkBuffer magnitude;
+        bigint_parse_decimal(&magnitude, digits, &powers);
+        ConstBigIntView view = magnitude.view();
+        if(view.signum != 0)
+        {
+            view.signum = signum;
+        }
+        return finalize_bigint(thread, view);
     }
 
 }  // namespace cl
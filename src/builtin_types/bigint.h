@@ -10,6 +10,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace cl
@@ -186,6 +187,11 @@ namespace cl
     int compare_bigint_abs(ConstBigIntView left, ConstBigIntView right);
     int compare_bigint(ConstBigIntView left, ConstBigIntView right);
     std::wstring bigint_to_decimal_string(ConstBigIntView view);
+    // Builds the int with the given sign and the magnitude spelled by a run
+    // of ASCII decimal digits, with no sign, whitespace or underscores.
+    [[nodiscard]] Expected<Value>
+    bigint_from_decimal_digits(ThreadState *thread, std::string_view digits,
+                               signum_t signum);
 
 }  // namespace cl
 
@@ -245,6 +245,40 @@ namespace cl
                    : Value::False();
     }
 
+    static Value trusted_dict_len_handler(ThreadState *thread, Value self)
+    {
+        (void)thread;
+        return Value::from_smi(
+            static_cast<int64_t>(self.get_ptr<Dict>()->size()));
+    }
+
+    using DictLenHandler =
+        TrustedHandlerDefinition<trusted_dict_len_handler,
+                                 TrustedHandlerEffects::None,
+                                 TrustedHandlerSemantics::Length>;
+
+    class DictLenResolver final
+        : public TrustedHandlerResolverBase<DictLenHandler>
+    {
+    public:
+        static TrustedResolution resolve(VirtualMachine *vm,
+                                         ShapeKey container_key,
+                                         ShapeKey operand1_key,
+                                         TrustedHandlerOperandOrder order,
+                                         TrustedHandlerArity requested_arity)
+        {
+            (void)operand1_key;
+            assert(order == TrustedHandlerOperandOrder::Normal);
+            if(requested_arity != TrustedHandlerArity::Unary ||
+               vm->shape_for_key(container_key)->get_class() !=
+                   vm->dict_class())
+            {
+                return TrustedResolution::no_trusted_handler_call_untrusted();
+            }
+            return Handler<0>::resolution();
+        }
+    };
+
     static bool trusted_dict_str_key_shapes_match(VirtualMachine *vm,
                                                   ShapeKey container_key,
                                                   ShapeKey key_key)
@@ -1039,8 +1073,9 @@ namespace cl
                                      L"Return str(self)."),
             builtin_intrinsic_method(L"__repr__", native_dict_repr,
                                      L"Return repr(self)."),
-            builtin_intrinsic_method(L"__len__", native_dict_len,
-                                     L"Return len(self)."),
+            with_trusted_handler_resolver<DictLenResolver>(
+                vm, builtin_intrinsic_method(L"__len__", native_dict_len,
+                                             L"Return len(self).")),
         };
         unwrap_bootstrap_expected(
             vm,
@@ -1,67 +1,378 @@
 #include "builtin_types/float.h"
 
+#include "builtin_types/bigint.h"
 #include "builtin_types/str.h"
+#include "builtin_types/tuple.h"
 #include "object_model/class_object.h"
 #include "object_model/native_function.h"
 #include "object_model/shape_key.h"
 #include "runtime/thread_state.h"
 #include "runtime/virtual_machine.h"
+#include "object_model/owned.h"
 #include "util/fixed_wide_string.h"
+#include <cassert>
+#include <charconv>
 #include <cmath>
-#include <fmt/format.h>
+#include <cstdlib>
+#include <cwctype>
 #include <iterator>
 #include <string>
+#include <string_view>
+#include <system_error>
 
 namespace cl
 {
+    bool is_exact_float_shape_key(VirtualMachine *vm, ShapeKey key)
+    {
+        if(key == ShapeKey::from_shape(
+                      vm->float_class()->get_instance_root_shape()))
+        {
+            return true;
+        }
+        if constexpr(value_immediate_floats)
+        {
+            Value immediate_zero;
+            immediate_zero.as.integer = value_immediate_float_tag;
+            return key == ShapeKey::from_value(immediate_zero);
+        }
+        return false;
+    }
+
     Value box_float(ThreadState *thread, double value)
     {
+        Value immediate;
+        if(Value::try_from_immediate_float(value, &immediate))
+        {
+            return immediate;
+        }
+        if(Float *recycled =
+               thread->make_object_raw_in_recycled_cell<Float>(value))
+        {
+            return Value::from_oop(recycled);
+        }
         return thread->make_object_value<Float>(value).raw_value();
     }
 
-    static std::wstring format_float_value(double value)
+    // Longest repr: a sign, 17 significant digits, a point and "e-308".
+    static constexpr size_t float_repr_max_chars = 32;
+
+    static size_t copy_ascii(wchar_t *out, const char *text)
+    {
+        size_t n_chars = 0;
+        for(; text[n_chars] != '\0'; ++n_chars)
+        {
+            out[n_chars] = static_cast<wchar_t>(text[n_chars]);
+        }
+        return n_chars;
+    }
+
+    /*
+      Writes repr(value) into out the way CPython's 'short' float repr style
+      does. std::to_chars supplies the shortest digit string that round-trips;
+      the digits are laid out in fixed notation when the decimal point lands
+      in (-4, 16] and in exponent notation with at least two exponent digits
+      otherwise. Returns the number of characters written.
+    */
+    static size_t format_float_repr(double value, wchar_t *out)
     {
         if(std::isnan(value))
         {
-            return L"nan";
+            return copy_ascii(out, "nan");
         }
         if(std::isinf(value))
         {
-            return std::signbit(value) ? L"-inf" : L"inf";
+            return copy_ascii(out, std::signbit(value) ? "-inf" : "inf");
+        }
+
+        char scientific[float_repr_max_chars];
+        std::to_chars_result converted =
+            std::to_chars(scientific, scientific + sizeof(scientific), value,
+                          std::chars_format::scientific);
+        assert(converted.ec == std::errc());
+
+        size_t n_chars = 0;
+        const char *cursor = scientific;
+        if(*cursor == '-')
+        {
+            out[n_chars++] = L'-';
+            ++cursor;
+        }
+        char digit_buffer[20];
+        size_t n_digits = 0;
+        for(; *cursor != 'e'; ++cursor)
+        {
+            if(*cursor != '.')
+            {
+                digit_buffer[n_digits++] = *cursor;
+            }
+        }
+        ++cursor;
+        bool negative_exponent = *cursor == '-';
+        ++cursor;
+        int exponent = 0;
+        std::from_chars(cursor, converted.ptr, exponent);
+        if(negative_exponent)
+        {
+            exponent = -exponent;
+        }
+
+        auto put_digits = [&](size_t begin, size_t end) {
+            for(size_t idx = begin; idx < end; ++idx)
+            {
+                out[n_chars++] = static_cast<wchar_t>(digit_buffer[idx]);
+            }
+        };
+        int decimal_point = exponent + 1;
+        if(decimal_point > -4 && decimal_point <= 16)
+        {
+            if(decimal_point <= 0)
+            {
+                out[n_chars++] = L'0';
+                out[n_chars++] = L'.';
+                for(int idx = decimal_point; idx < 0; ++idx)
+                {
+                    out[n_chars++] = L'0';
+                }
+                put_digits(0, n_digits);
+            }
+            else if(size_t(decimal_point) >= n_digits)
+            {
+                put_digits(0, n_digits);
+                for(size_t idx = n_digits; idx < size_t(decimal_point); ++idx)
+                {
+                    out[n_chars++] = L'0';
+                }
+                out[n_chars++] = L'.';
+                out[n_chars++] = L'0';
+            }
+            else
+            {
+                put_digits(0, size_t(decimal_point));
+                out[n_chars++] = L'.';
+                put_digits(size_t(decimal_point), n_digits);
+            }
+            return n_chars;
         }
 
-        std::string text = fmt::format("{}", value);
-        if(text.find_first_of(".eE") == std::string::npos)
+        put_digits(0, 1);
+        if(n_digits > 1)
+        {
+            out[n_chars++] = L'.';
+            put_digits(1, n_digits);
+        }
+        out[n_chars++] = L'e';
+        out[n_chars++] = exponent < 0 ? L'-' : L'+';
+        int magnitude = exponent < 0 ? -exponent : exponent;
+        if(magnitude < 10)
+        {
+            out[n_chars++] = L'0';
+        }
+        wchar_t exponent_digits[4];
+        size_t n_exponent_digits = 0;
+        for(; magnitude != 0; magnitude /= 10)
         {
-            text += ".0";
+            exponent_digits[n_exponent_digits++] =
+                static_cast<wchar_t>(L'0' + magnitude % 10);
         }
-        return std::wstring(text.begin(), text.end());
+        while(n_exponent_digits > 0)
+        {
+            out[n_chars++] = exponent_digits[--n_exponent_digits];
+        }
+        return n_chars;
+    }
+
+    static Value make_float_repr_string(ThreadState *thread, double value)
+    {
+        wchar_t text[float_repr_max_chars];
+        size_t n_chars = format_float_repr(value, text);
+        return thread
+            ->make_object_value<String>(std::wstring_view(text, n_chars))
+            .raw_value();
     }
 
     static Value native_float_str(ThreadState *thread, Value self)
     {
-        if(!can_convert_to<Float>(self))
+        if(!is_float_value(self))
         {
-            return active_thread()->set_pending_builtin_exception_string(
+            return thread->set_pending_builtin_exception_string(
                 L"TypeError", L"float.__str__ expects a float receiver");
         }
-        return active_thread()
-            ->make_object_value<String>(
-                format_float_value(self.get_ptr<Float>()->value()))
-            .raw_value();
+        return make_float_repr_string(thread, float_value(self));
     }
 
     static Value native_float_repr(ThreadState *thread, Value self)
     {
-        if(!can_convert_to<Float>(self))
+        if(!is_float_value(self))
         {
-            return active_thread()->set_pending_builtin_exception_string(
+            return thread->set_pending_builtin_exception_string(
                 L"TypeError", L"float.__repr__ expects a float receiver");
         }
-        return active_thread()
-            ->make_object_value<String>(
-                format_float_value(self.get_ptr<Float>()->value()))
-            .raw_value();
+        return make_float_repr_string(thread, float_value(self));
+    }
+
+    static bool equals_ascii_ignoring_case(std::wstring_view text,
+                                           const char *word)
+    {
+        size_t idx = 0;
+        for(; word[idx] != '\0'; ++idx)
+        {
+            if(idx == text.size() ||
+               std::towlower(text[idx]) != static_cast<wint_t>(word[idx]))
+            {
+                return false;
+            }
+        }
+        return idx == text.size();
+    }
+
+    static bool is_ascii_digit(wchar_t ch) { return ch >= L'0' && ch <= L'9'; }
+
+    /*
+      Parses the float() string grammar: surrounding whitespace, an optional
+      sign, then either a decimal literal with single underscores between
+      digits or inf, infinity or nan in any case. The literal is narrowed
+      into a stack buffer and handed to std::from_chars, whose shortest-path
+      Eisel-Lemire parse rounds correctly without going through strtod.
+    */
+    static bool parse_float_text(std::wstring_view text, double *out)
+    {
+        while(!text.empty() && std::iswspace(text.front()))
+        {
+            text.remove_prefix(1);
+        }
+        while(!text.empty() && std::iswspace(text.back()))
+        {
+            text.remove_suffix(1);
+        }
+
+        bool negative = false;
+        if(!text.empty() && (text.front() == L'+' || text.front() == L'-'))
+        {
+            negative = text.front() == L'-';
+            text.remove_prefix(1);
+        }
+        if(equals_ascii_ignoring_case(text, "inf") ||
+           equals_ascii_ignoring_case(text, "infinity"))
+        {
+            *out = negative ? -HUGE_VAL : HUGE_VAL;
+            return true;
+        }
+        if(equals_ascii_ignoring_case(text, "nan"))
+        {
+            *out = negative ? -std::nan("") : std::nan("");
+            return true;
+        }
+
+        static constexpr size_t inline_literal_chars = 64;
+        char inline_literal[inline_literal_chars];
+        std::string long_literal;
+        char *literal = inline_literal;
+        if(text.size() >= inline_literal_chars)
+        {
+            long_literal.resize(text.size() + 1);
+            literal = long_literal.data();
+        }
+
+        size_t n_chars = 0;
+        for(size_t idx = 0; idx < text.size(); ++idx)
+        {
+            wchar_t ch = text[idx];
+            if(ch == L'_')
+            {
+                if(idx == 0 || idx + 1 == text.size() ||
+                   !is_ascii_digit(text[idx - 1]) ||
+                   !is_ascii_digit(text[idx + 1]))
+                {
+                    return false;
+                }
+                continue;
+            }
+            bool sign_after_exponent =
+                (ch == L'+' || ch == L'-') && idx > 0 &&
+                (text[idx - 1] == L'e' || text[idx - 1] == L'E');
+            if(!is_ascii_digit(ch) && ch != L'.' && ch != L'e' && ch != L'E' &&
+               !sign_after_exponent)
+            {
+                return false;
+            }
+            literal[n_chars++] = static_cast<char>(ch);
+        }
+        if(n_chars == 0)
+        {
+            return false;
+        }
+        literal[n_chars] = '\0';
+
+        double value = 0.0;
+        std::from_chars_result parsed =
+            std::from_chars(literal, literal + n_chars, value);
+        if(parsed.ptr != literal + n_chars)
+        {
+            return false;
+        }
+        if(parsed.ec == std::errc::result_out_of_range)
+        {
+            // Overflow to infinity or underflow to zero, as float() reports.
+            value = std::strtod(literal, nullptr);
+        }
+        else if(parsed.ec != std::errc())
+        {
+            return false;
+        }
+        *out = negative ? -value : value;
+        return true;
+    }
+
+    static Value native_float_new(ThreadState *thread, Value cls_value,
+                                  Value obj)
+    {
+        if(cls_value != Value::from_oop(thread->get_machine()->float_class()))
+        {
+            return thread->set_pending_builtin_exception_string(
+                L"TypeError", L"float.__new__ expects float as cls");
+        }
+
+        if(is_float_value(obj))
+        {
+            return obj;
+        }
+        if((obj.as.integer & value_not_smi_or_boolean_mask) == 0)
+        {
+            Value integer_value;
+            integer_value.as.integer =
+                obj.as.integer & value_boolean_to_integer_mask;
+            return box_float(thread,
+                             static_cast<double>(integer_value.get_smi()));
+        }
+        if(can_convert_to<BigInt>(obj))
+        {
+            Expected<double> converted =
+                bigint_to_double(assume_convert_to<BigInt>(obj)->view());
+            if(converted.has_exception())
+            {
+                return Value::exception_marker();
+            }
+            return box_float(thread, converted.value());
+        }
+        if(can_convert_to<String>(obj))
+        {
+            String *str = obj.get_ptr<String>();
+            std::wstring_view text(str->data, size_t(str->count.extract()));
+            double parsed;
+            if(!parse_float_text(text, &parsed))
+            {
+                std::wstring message =
+                    L"could not convert string to float: '" +
+                    std::wstring(text) + L"'";
+                return thread->set_pending_builtin_exception_string(
+                    L"ValueError", message.c_str());
+            }
+            return box_float(thread, parsed);
+        }
+
+        return thread->set_pending_builtin_exception_string(
+            L"TypeError",
+            L"float() argument must be a string or a real number");
     }
 
     static bool try_get_float_or_smi_or_bool(Value value, double *out)
@@ -74,9 +385,9 @@ namespace cl
             *out = static_cast<double>(integer_value.get_smi());
             return true;
         }
-        if(can_convert_to<Float>(value))
+        if(is_float_value(value))
         {
-            *out = value.get_ptr<Float>()->value();
+            *out = float_value(value);
             return true;
         }
         return false;
@@ -105,23 +416,23 @@ namespace cl
 
     static Value float_add(ThreadState *thread, double left, double right)
     {
-        return thread->make_object_value<Float>(left + right).raw_value();
+        return box_float(thread, left + right);
     }
 
     static Value float_subtract(ThreadState *thread, double left, double right)
     {
-        return thread->make_object_value<Float>(left - right).raw_value();
+        return box_float(thread, left - right);
     }
 
     static Value float_reverse_subtract(ThreadState *thread, double left,
                                         double right)
     {
-        return thread->make_object_value<Float>(right - left).raw_value();
+        return box_float(thread, right - left);
     }
 
     static Value float_multiply(ThreadState *thread, double left, double right)
     {
-        return thread->make_object_value<Float>(left * right).raw_value();
+        return box_float(thread, left * right);
     }
 
     static Value float_zero_division_error(ThreadState *thread)
@@ -177,7 +488,7 @@ namespace cl
         {
             return float_zero_division_error(thread);
         }
-        return thread->make_object_value<Float>(left / right).raw_value();
+        return box_float(thread, left / right);
     }
 
     static Value float_reverse_true_divide(ThreadState *thread, double left,
@@ -187,7 +498,7 @@ namespace cl
         {
             return float_zero_division_error(thread);
         }
-        return thread->make_object_value<Float>(right / left).raw_value();
+        return box_float(thread, right / left);
     }
 
     static Value float_floor_divide(ThreadState *thread, double left,
@@ -197,9 +508,7 @@ namespace cl
         {
             return float_zero_division_error(thread);
         }
-        return thread
-            ->make_object_value<Float>(float_divmod(left, right).quotient)
-            .raw_value();
+        return box_float(thread, float_divmod(left, right).quotient);
     }
 
     static Value float_reverse_floor_divide(ThreadState *thread, double left,
@@ -209,9 +518,7 @@ namespace cl
         {
             return float_zero_division_error(thread);
         }
-        return thread
-            ->make_object_value<Float>(float_divmod(right, left).quotient)
-            .raw_value();
+        return box_float(thread, float_divmod(right, left).quotient);
     }
 
     static Value float_modulo_result(ThreadState *thread, double left,
@@ -222,9 +529,7 @@ namespace cl
             return float_zero_division_error(thread);
         }
 
-        return thread
-            ->make_object_value<Float>(float_divmod(left, right).remainder)
-            .raw_value();
+        return box_float(thread, float_divmod(left, right).remainder);
     }
 
     static Value float_modulo(ThreadState *thread, double left, double right)
@@ -266,7 +571,12 @@ namespace cl
 
     static Value float_negate(ThreadState *thread, double value)
     {
-        return thread->make_object_value<Float>(-value).raw_value();
+        return box_float(thread, -value);
+    }
+
+    static Value float_abs(ThreadState *thread, double value)
+    {
+        return box_float(thread, std::fabs(value));
     }
 
     using FloatBinaryFunction = Value (*)(ThreadState *, double, double);
@@ -284,7 +594,7 @@ namespace cl
 
         static Value native(ThreadState *thread, Value self, Value other)
         {
-            if(!can_convert_to<Float>(self))
+            if(!is_float_value(self))
             {
                 return thread->set_pending_builtin_exception_string(
                     L"TypeError", ReceiverError.c_str());
@@ -295,7 +605,7 @@ namespace cl
             {
                 return Value::NotImplemented();
             }
-            return Function(thread, self.get_ptr<Float>()->value(), right);
+            return Function(thread, float_value(self), right);
         }
 
         template <TrustedHandlerEffects Effects,
@@ -316,19 +626,19 @@ namespace cl
     {
         if constexpr(Adaptation == FloatBinaryAdaptation::FloatFloat)
         {
-            return Function(thread, left.get_ptr<Float>()->value(),
-                            right.get_ptr<Float>()->value());
+            return Function(thread, float_value(left),
+                            float_value(right));
         }
         else if constexpr(Adaptation == FloatBinaryAdaptation::FloatIntlike)
         {
-            return Function(thread, left.get_ptr<Float>()->value(),
+            return Function(thread, float_value(left),
                             smi_or_bool_as_double(right));
         }
         else
         {
             static_assert(Adaptation == FloatBinaryAdaptation::IntlikeFloat);
             return Function(thread, smi_or_bool_as_double(left),
-                            right.get_ptr<Float>()->value());
+                            float_value(right));
         }
     }
 
@@ -371,12 +681,12 @@ namespace cl
 
         static Value native(ThreadState *thread, Value self)
         {
-            if(!can_convert_to<Float>(self))
+            if(!is_float_value(self))
             {
                 return thread->set_pending_builtin_exception_string(
                     L"TypeError", ReceiverError.c_str());
             }
-            return Function(thread, self.get_ptr<Float>()->value());
+            return Function(thread, float_value(self));
         }
 
         template <TrustedHandlerEffects Effects,
@@ -388,7 +698,7 @@ namespace cl
     static Value trusted_adapted_float_unary_operation(ThreadState *thread,
                                                        Value value)
     {
-        return Function(thread, value.get_ptr<Float>()->value());
+        return Function(thread, float_value(value));
     }
 
     template <typename Operation, TrustedHandlerEffects Effects,
@@ -425,11 +735,11 @@ namespace cl
             using FloatIntlike = typename Handlers::FloatIntlike;
             using IntlikeFloat = typename Handlers::IntlikeFloat;
 
-            ShapeKey float_key = ShapeKey::from_shape(
-                vm->float_class()->get_instance_root_shape());
-            if(operand0_key == float_key)
+            bool operand0_float = is_exact_float_shape_key(vm, operand0_key);
+            bool operand1_float = is_exact_float_shape_key(vm, operand1_key);
+            if(operand0_float)
             {
-                if(operand1_key == float_key)
+                if(operand1_float)
                 {
                     return FloatFloat::resolution();
                 }
@@ -438,8 +748,7 @@ namespace cl
                     return FloatIntlike::resolution();
                 }
             }
-            if(is_smi_or_bool_shape_key(operand0_key) &&
-               operand1_key == float_key)
+            if(is_smi_or_bool_shape_key(operand0_key) && operand1_float)
             {
                 return IntlikeFloat::resolution();
             }
@@ -626,23 +935,30 @@ namespace cl
     using FloatNegOperation =
         FloatUnaryOperation<float_negate,
                             L"float.__neg__ expects a float receiver">;
+    using FloatAbsOperation =
+        FloatUnaryOperation<float_abs,
+                            L"float.__abs__ expects a float receiver">;
     struct FloatPosOperation
     {
         static Value native(ThreadState *thread, Value self)
         {
-            if(!can_convert_to<Float>(self))
+            if(!is_float_value(self))
             {
                 return thread->set_pending_builtin_exception_string(
                     L"TypeError", L"float.__pos__ expects a float receiver");
             }
 
+            if(self.is_immediate_float())
+            {
+                return self;
+            }
             Float *value = self.get_ptr<Float>();
             if(value->get_shape() ==
                thread->get_machine()->float_class()->get_instance_root_shape())
             {
                 return self;
             }
-            return thread->make_object_value<Float>(value->value()).raw_value();
+            return box_float(thread, value->value());
         }
 
         static Value trusted(ThreadState *thread, Value value)
@@ -661,6 +977,9 @@ namespace cl
     using FloatPosHandler =
         FloatPosOperation::Handler<TrustedHandlerEffects::None,
                                    TrustedHandlerSemantics::Pos>;
+    using FloatAbsHandler =
+        FloatAbsOperation::Handler<TrustedHandlerEffects::Allocate,
+                                   TrustedHandlerSemantics::Abs>;
 
     template <typename HandlerDefinition>
     class FloatUnaryResolver final
@@ -683,9 +1002,7 @@ namespace cl
             {
                 return TrustedResolution::no_trusted_handler_call_untrusted();
             }
-            ShapeKey float_key = ShapeKey::from_shape(
-                vm->float_class()->get_instance_root_shape());
-            if(operand0_key == float_key)
+            if(is_exact_float_shape_key(vm, operand0_key))
             {
                 return Handler::resolution();
             }
@@ -695,6 +1012,7 @@ namespace cl
 
     using FloatNegResolver = FloatUnaryResolver<FloatNegHandler>;
     using FloatPosResolver = FloatUnaryResolver<FloatPosHandler>;
+    using FloatAbsResolver = FloatUnaryResolver<FloatAbsHandler>;
 
     BuiltinClassDefinition make_float_class(VirtualMachine *vm)
     {
@@ -710,7 +1028,14 @@ namespace cl
 
     void install_float_class_methods(VirtualMachine *vm)
     {
+        Owned<TValue<Tuple>> float_new_defaults(
+            active_thread()->make_object_value<Tuple>(1));
+        float_new_defaults.extract()->initialize_item_unchecked(
+            0, box_float(active_thread(), 0.0));
         BuiltinIntrinsicMethod methods[] = {
+            with_defaults(builtin_intrinsic_method(L"__new__", native_float_new,
+                                                   L"Create a float object."),
+                          float_new_defaults.value()),
             builtin_intrinsic_method(L"__str__", native_float_str,
                                      L"Return str(self)."),
             builtin_intrinsic_method(L"__repr__", native_float_repr,
@@ -795,6 +1120,10 @@ namespace cl
                 vm,
                 builtin_intrinsic_method(L"__pos__", FloatPosOperation::native,
                                          L"Return +self.")),
+            with_trusted_handler_resolver<FloatAbsResolver>(
+                vm,
+                builtin_intrinsic_method(L"__abs__", FloatAbsOperation::native,
+                                         L"Return abs(self).")),
         };
         unwrap_bootstrap_expected(
             vm,
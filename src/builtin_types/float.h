@@ -3,11 +3,13 @@
 
 #include "object_model/builtin_class_registry.h"
 #include "object_model/object.h"
+#include "object_model/value.h"
 
 #include <cstddef>
 
 namespace cl
 {
+    class ShapeKey;
     class ThreadState;
     class VirtualMachine;
 
@@ -33,6 +35,29 @@ namespace cl
 
     inline size_t Float::value_offset() { return CL_OFFSETOF(Float, value_); }
 
+    /*
+      A float value is either a `Float` object or, in immediate-float builds,
+      an inline value (see value.h). Code outside the float implementation
+      reads floats through these helpers instead of `Float` directly.
+    */
+    ALWAYSINLINE bool is_float_value(Value value)
+    {
+        return value.is_immediate_float() || can_convert_to<Float>(value);
+    }
+
+    ALWAYSINLINE double float_value(Value value)
+    {
+        if(value.is_immediate_float())
+        {
+            return value.get_immediate_float();
+        }
+        return value.get_ptr<Float>()->value();
+    }
+
+    // Whether `key` is an exact float: the float root shape, or the
+    // immediate float tag.
+    bool is_exact_float_shape_key(VirtualMachine *vm, ShapeKey key);
+
     [[nodiscard]] Value box_float(ThreadState *thread, double value);
     BuiltinClassDefinition make_float_class(VirtualMachine *vm);
     void install_float_class_methods(VirtualMachine *vm);
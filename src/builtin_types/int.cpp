@@ -201,21 +201,15 @@ namespace cl
             digit_begin = 1;
         }
 
-        size_t scratch_capacity = text.size() - digit_begin + 1;
-        BigIntScratch scratch0(scratch_capacity);
-        BigIntScratch scratch1(scratch_capacity);
-        MutableBigIntView initial = scratch0.mutable_view();
-        ConstBigIntView current{0, 0, initial.digits};
-        bool use_first_scratch = false;
-        bool saw_digit = false;
+        std::string digits;
+        digits.reserve(text.size() - digit_begin);
         bool previous_underscore = false;
-
         for(size_t idx = digit_begin; idx < text.size(); ++idx)
         {
             cl_wchar ch = text[idx];
             if(ch == L'_')
             {
-                if(!saw_digit || previous_underscore)
+                if(digits.empty() || previous_underscore)
                 {
                     return invalid_int_literal(thread);
                 }
@@ -226,28 +220,29 @@ namespace cl
             {
                 return invalid_int_literal(thread);
             }
-
-            MutableBigIntView dest = use_first_scratch
-                                         ? scratch0.mutable_view()
-                                         : scratch1.mutable_view();
-            bigint_abs_mul_add_u32(&dest, current, 10,
-                                   static_cast<uint32_t>(ch - L'0'));
-            current = dest.view();
-            use_first_scratch = !use_first_scratch;
-            saw_digit = true;
+            digits.push_back(static_cast<char>(ch));
             previous_underscore = false;
         }
-        if(!saw_digit || previous_underscore)
+        if(digits.empty() || previous_underscore)
         {
             return invalid_int_literal(thread);
         }
 
-        current = normalize_bigint_view(current);
-        if(current.signum != 0)
+        int64_t max_digits = active_vm()->int_max_str_digits();
+        if(max_digits != 0 && digits.size() > uint64_t(max_digits))
         {
-            current.signum = negative ? -1 : 1;
+            std::wstring message =
+                L"Exceeds the limit (" + std::to_wstring(max_digits) +
+                L" digits) for integer string conversion: value has " +
+                std::to_wstring(digits.size()) +
+                L" digits; use sys.set_int_max_str_digits() to increase the "
+                L"limit";
+            return thread->set_pending_builtin_exception_string(
+                L"ValueError", message.c_str());
         }
-        Expected<Value> result = finalize_bigint(thread, current);
+
+        Expected<Value> result =
+            bigint_from_decimal_digits(thread, digits, negative ? -1 : 1);
         if(result.has_exception())
         {
             return Value::exception_marker();
@@ -341,10 +336,32 @@ namespace cl
         if(can_convert_to<BigInt>(self))
         {
             BigInt *bigint = assume_convert_to<BigInt>(self);
-            return thread
-                ->make_object_value<String>(
-                    bigint_to_decimal_string(bigint->view()))
-                .raw_value();
+            ConstBigIntView view = bigint->view();
+            int64_t max_digits = active_vm()->int_max_str_digits();
+            // Each digit carries at least 9.63 decimal digits, so the size
+            // alone rejects oversized values before the conversion runs.
+            bool too_many_digits =
+                max_digits != 0 &&
+                (view.n_digits - 1) * 9632 / 1000 >= uint64_t(max_digits);
+            std::wstring text;
+            if(!too_many_digits)
+            {
+                text = bigint_to_decimal_string(view);
+                size_t n_decimal_digits =
+                    text.size() - (view.signum < 0 ? 1 : 0);
+                too_many_digits =
+                    max_digits != 0 && n_decimal_digits > uint64_t(max_digits);
+            }
+            if(too_many_digits)
+            {
+                std::wstring message =
+                    L"Exceeds the limit (" + std::to_wstring(max_digits) +
+                    L" digits) for integer string conversion; use "
+                    L"sys.set_int_max_str_digits() to increase the limit";
+                return thread->set_pending_builtin_exception_string(
+                    L"ValueError", message.c_str());
+            }
+            return thread->make_object_value<String>(text).raw_value();
         }
 
         return thread->set_pending_builtin_exception_string(
@@ -568,9 +585,7 @@ namespace cl
             {
                 return int_zero_division_error(thread);
             }
-            return thread
-                ->make_object_value<Float>(double(left) / double(right))
-                .raw_value();
+            return box_float(thread, double(left) / double(right));
         }
     };
 
@@ -601,7 +616,7 @@ namespace cl
                 L"OverflowError", L"float power result too large");
         }
         double result = negative_result ? -magnitude : magnitude;
-        return thread->make_object_value<Float>(result).raw_value();
+        return box_float(thread, result);
     }
 
     static Value int_bigint_negative_exponent_pow(ThreadState *thread,
@@ -1214,6 +1229,21 @@ namespace cl
         }
     };
 
+    struct SMIAbsOperator
+    {
+        static constexpr const wchar_t *receiver_error =
+            L"int.__abs__ expects an int receiver";
+
+        Value operator()(ThreadState *thread, int64_t value) const
+        {
+            if(value < 0)
+            {
+                return SMINegOperator{}(thread, value);
+            }
+            return Value::from_smi(value);
+        }
+    };
+
     struct SMIInvertOperator
     {
         static constexpr const wchar_t *receiver_error =
@@ -1374,6 +1404,31 @@ namespace cl
             L"TypeError", SMIPosOperator::receiver_error);
     }
 
+    static Value native_int_abs(ThreadState *thread, Value self)
+    {
+        int64_t value;
+        if(try_get_smi_or_bool(self, &value))
+        {
+            return SMIAbsOperator{}(thread, value);
+        }
+        if(can_convert_to<BigInt>(self))
+        {
+            BigInt *bigint = assume_convert_to<BigInt>(self);
+            if(bigint->view().signum >= 0)
+            {
+                return self;
+            }
+            Expected<Value> result = bigint_negate(thread, bigint->view());
+            if(result.has_exception())
+            {
+                return Value::exception_marker();
+            }
+            return result.value();
+        }
+        return thread->set_pending_builtin_exception_string(
+            L"TypeError", SMIAbsOperator::receiver_error);
+    }
+
     template <typename Operator>
     static Value native_int_binary_operator(ThreadState *thread, Value self,
                                             Value other)
@@ -1595,12 +1650,6 @@ namespace cl
                           vm->int_class()->get_instance_root_shape());
     }
 
-    static bool is_float_shape_key(VirtualMachine *vm, ShapeKey key)
-    {
-        return key == ShapeKey::from_shape(
-                          vm->float_class()->get_instance_root_shape());
-    }
-
     static bool is_bigint_shape_key(VirtualMachine *vm, ShapeKey key)
     {
         return key ==
@@ -1640,8 +1689,8 @@ namespace cl
                 trusted_intlike_intlike_operator<Operator>);
         }
         if((is_smi_or_bool_shape_key(operand0_key) &&
-            is_float_shape_key(vm, operand1_key)) ||
-           (is_float_shape_key(vm, operand0_key) &&
+            is_exact_float_shape_key(vm, operand1_key)) ||
+           (is_exact_float_shape_key(vm, operand0_key) &&
             is_smi_or_bool_shape_key(operand1_key)))
         {
             return TrustedResolution::known_not_implemented_skip_method();
@@ -1660,8 +1709,8 @@ namespace cl
                 trusted_intlike_bigint_operator<Operator>);
         }
         if((is_intlike_shape_key(vm, operand0_key) &&
-            is_float_shape_key(vm, operand1_key)) ||
-           (is_float_shape_key(vm, operand0_key) &&
+            is_exact_float_shape_key(vm, operand1_key)) ||
+           (is_exact_float_shape_key(vm, operand0_key) &&
             is_intlike_shape_key(vm, operand1_key)))
         {
             return TrustedResolution::known_not_implemented_skip_method();
@@ -1722,8 +1771,8 @@ namespace cl
                 trusted_intlike_bigint_operator<BigIntOperator>);
         }
         if((is_intlike_shape_key(vm, operand0_key) &&
-            is_float_shape_key(vm, operand1_key)) ||
-           (is_float_shape_key(vm, operand0_key) &&
+            is_exact_float_shape_key(vm, operand1_key)) ||
+           (is_exact_float_shape_key(vm, operand0_key) &&
             is_intlike_shape_key(vm, operand1_key)))
         {
             return TrustedResolution::known_not_implemented_skip_method();
@@ -2064,6 +2113,10 @@ namespace cl
                 builtin_intrinsic_method(L"__pos__", native_int_pos,
                                          L"Return +self."),
                 resolve_trusted_int_unary_handler<SMIPosOperator>),
+            with_trusted_handler_resolver(
+                builtin_intrinsic_method(L"__abs__", native_int_abs,
+                                         L"Return abs(self)."),
+                resolve_trusted_int_unary_handler<SMIAbsOperator>),
             with_trusted_handler_resolver(
                 builtin_intrinsic_method(
                     L"__invert__",
@@ -188,6 +188,40 @@ namespace cl
         return Value::None();
     }
 
+    static Value trusted_list_len_handler(ThreadState *thread, Value self)
+    {
+        (void)thread;
+        return Value::from_smi(
+            static_cast<int64_t>(self.get_ptr<List>()->size()));
+    }
+
+    using ListLenHandler =
+        TrustedHandlerDefinition<trusted_list_len_handler,
+                                 TrustedHandlerEffects::None,
+                                 TrustedHandlerSemantics::Length>;
+
+    class ListLenResolver final
+        : public TrustedHandlerResolverBase<ListLenHandler>
+    {
+    public:
+        static TrustedResolution resolve(VirtualMachine *vm,
+                                         ShapeKey container_key,
+                                         ShapeKey operand1_key,
+                                         TrustedHandlerOperandOrder order,
+                                         TrustedHandlerArity requested_arity)
+        {
+            (void)operand1_key;
+            assert(order == TrustedHandlerOperandOrder::Normal);
+            if(requested_arity != TrustedHandlerArity::Unary ||
+               vm->shape_for_key(container_key)->get_class() !=
+                   vm->list_class())
+            {
+                return TrustedResolution::no_trusted_handler_call_untrusted();
+            }
+            return Handler<0>::resolution();
+        }
+    };
+
     static TrustedResolution resolve_trusted_list_getitem_handler(
         VirtualMachine *vm, ShapeKey container_key, ShapeKey key_key,
         TrustedHandlerOperandOrder order, TrustedHandlerArity requested_arity)
@@ -417,8 +451,9 @@ namespace cl
                                      L"Return str(self)."),
             builtin_intrinsic_method(L"__repr__", native_list_repr,
                                      L"Return repr(self)."),
-            builtin_intrinsic_method(L"__len__", native_list_len,
-                                     L"Return len(self)."),
+            with_trusted_handler_resolver<ListLenResolver>(
+                vm, builtin_intrinsic_method(L"__len__", native_list_len,
+                                             L"Return len(self).")),
             with_trusted_handler_resolver(
                 builtin_intrinsic_method(L"__getitem__", native_list_getitem,
                                          L"Return self[index]."),
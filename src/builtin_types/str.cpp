@@ -334,6 +334,43 @@ namespace cl
                                                                operand1_key);
     }
 
+    static Value trusted_str_len(ThreadState *thread, Value value)
+    {
+        (void)thread;
+        return value.get_ptr<String>()->count.raw_value();
+    }
+
+    using StrLenHandler =
+        TrustedHandlerDefinition<trusted_str_len, TrustedHandlerEffects::None,
+                                 TrustedHandlerSemantics::Length>;
+
+    class StrLenResolver final
+        : public TrustedHandlerResolverBase<StrLenHandler>
+    {
+    public:
+        static TrustedResolution resolve(VirtualMachine *vm,
+                                         ShapeKey operand0_key,
+                                         ShapeKey operand1_key,
+                                         TrustedHandlerOperandOrder order,
+                                         TrustedHandlerArity requested_arity)
+        {
+            (void)operand1_key;
+            (void)order;
+
+            if(requested_arity != TrustedHandlerArity::Unary)
+            {
+                return TrustedResolution::no_trusted_handler_call_untrusted();
+            }
+            ShapeKey str_key =
+                ShapeKey::from_shape(vm->str_instance_root_shape());
+            if(operand0_key == str_key)
+            {
+                return Handler<0>::resolution();
+            }
+            return TrustedResolution::no_trusted_handler_call_untrusted();
+        }
+    };
+
     static Value trusted_str_hash(ThreadState *thread, Value value)
     {
         (void)thread;
@@ -1731,8 +1768,9 @@ namespace cl
                                      L"Return str(self)."),
             builtin_intrinsic_method(L"__repr__", native_str_repr,
                                      L"Return repr(self)."),
-            builtin_intrinsic_method(L"__len__", native_str_len,
-                                     L"Return len(self)."),
+            with_trusted_handler_resolver<StrLenResolver>(
+                vm, builtin_intrinsic_method(L"__len__", native_str_len,
+                                             L"Return len(self).")),
             with_trusted_handler_resolver(
                 builtin_intrinsic_method(L"__hash__", native_str_hash,
                                          L"Return hash(self)."),
@@ -159,6 +159,40 @@ namespace cl
         return self.get_ptr<Tuple>()->get_slice(normalized).raw_value();
     }
 
+    static Value trusted_tuple_len_handler(ThreadState *thread, Value self)
+    {
+        (void)thread;
+        return Value::from_smi(
+            static_cast<int64_t>(self.get_ptr<Tuple>()->size()));
+    }
+
+    using TupleLenHandler =
+        TrustedHandlerDefinition<trusted_tuple_len_handler,
+                                 TrustedHandlerEffects::None,
+                                 TrustedHandlerSemantics::Length>;
+
+    class TupleLenResolver final
+        : public TrustedHandlerResolverBase<TupleLenHandler>
+    {
+    public:
+        static TrustedResolution resolve(VirtualMachine *vm,
+                                         ShapeKey container_key,
+                                         ShapeKey operand1_key,
+                                         TrustedHandlerOperandOrder order,
+                                         TrustedHandlerArity requested_arity)
+        {
+            (void)operand1_key;
+            assert(order == TrustedHandlerOperandOrder::Normal);
+            if(requested_arity != TrustedHandlerArity::Unary ||
+               vm->shape_for_key(container_key)->get_class() !=
+                   vm->tuple_class())
+            {
+                return TrustedResolution::no_trusted_handler_call_untrusted();
+            }
+            return Handler<0>::resolution();
+        }
+    };
+
     static TrustedResolution resolve_trusted_tuple_getitem_handler(
         VirtualMachine *vm, ShapeKey container_key, ShapeKey key_key,
         TrustedHandlerOperandOrder order, TrustedHandlerArity requested_arity)
@@ -278,8 +312,9 @@ namespace cl
                                      L"Return str(self)."),
             builtin_intrinsic_method(L"__repr__", native_tuple_repr,
                                      L"Return repr(self)."),
-            builtin_intrinsic_method(L"__len__", native_tuple_len,
-                                     L"Return len(self)."),
+            with_trusted_handler_resolver<TupleLenResolver>(
+                vm, builtin_intrinsic_method(L"__len__", native_tuple_len,
+                                             L"Return len(self).")),
             with_trusted_handler_resolver(
                 builtin_intrinsic_method(L"__getitem__", native_tuple_getitem,
                                          L"Return self[index]."),
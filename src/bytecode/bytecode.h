@@ -67,7 +67,9 @@ namespace cl
         FiveRegisters,
         SixRegisters,
         PositionalCall,
+        GlobalPositionalCall,
         KeywordCall,
+        UnpackCall,
         NativeTarget,
         RuntimeIntrinsic,
         CodeObjectCall,
@@ -271,12 +273,21 @@ namespace cl
                 return make_bytecode_format_info(
                     Operand::Register, Operand::Register,
                     Operand::ArgumentCount, Operand::FunctionCallCache);
+            case BytecodeFormat::GlobalPositionalCall:
+                return make_bytecode_format_info(
+                    Operand::Constant, Operand::ModuleGlobalReadCache,
+                    Operand::Register, Operand::Register,
+                    Operand::ArgumentCount, Operand::FunctionCallCache);
             case BytecodeFormat::KeywordCall:
                 return make_bytecode_format_info(
                     Operand::Register, Operand::Register,
                     Operand::ArgumentCount, Operand::Register,
                     Operand::KeywordCount, Operand::Constant,
                     Operand::KeywordCallCache);
+            case BytecodeFormat::UnpackCall:
+                return make_bytecode_format_info(
+                    Operand::Register, Operand::Register, Operand::Register,
+                    Operand::FunctionCallCache);
             case BytecodeFormat::NativeTarget:
                 return make_bytecode_format_info(Operand::NativeTarget);
             case BytecodeFormat::RuntimeIntrinsic:
@@ -249,6 +249,12 @@ namespace cl
                 effects.destination_accumulator();
                 break;
 
+            case Bytecode::LoadMethodAttr:
+                effects.source_register(0);
+                effects.destination_register(0);
+                effects.destination_accumulator();
+                break;
+
             case Bytecode::StoreAttr:
                 effects.source_register(0);
                 effects.source_accumulator();
@@ -434,6 +440,15 @@ namespace cl
                 effects.destination_accumulator();
                 break;
 
+            case Bytecode::CallGlobalSimple:
+                effects.destination_register(2);
+                if(effects.operand(4) != 0)
+                {
+                    effects.source_register(3, effects.operand(4));
+                }
+                effects.destination_accumulator();
+                break;
+
             case Bytecode::CallKeyword:
                 effects.source_register(0);
                 if(effects.operand(2) != 0)
@@ -447,6 +462,21 @@ namespace cl
                 effects.destination_accumulator();
                 break;
 
+            case Bytecode::CallUnpack:
+                effects.source_register(0);
+                effects.source_register(1);
+                effects.source_register(2);
+                effects.destination_accumulator();
+                break;
+
+            case Bytecode::CallUnpackKeyword:
+                effects.source_register(0);
+                effects.source_register(1);
+                effects.source_register(2);
+                effects.source_register(3);
+                effects.destination_accumulator();
+                break;
+
             case Bytecode::CallRuntimeIntrinsic0:
                 if(RuntimeIntrinsic0(effects.operand(0)) ==
                    RuntimeIntrinsic0::ImportStar)
@@ -508,6 +538,8 @@ namespace cl
                 break;
             case Bytecode::CreateList:
             case Bytecode::CreateTuple:
+            case Bytecode::ConcatUnpackArgs:
+            case Bytecode::MergeUnpackKwargs:
                 if(effects.operand(1) != 0)
                 {
                     effects.source_register(0, effects.operand(1));
@@ -544,6 +576,7 @@ namespace cl
 
             case Bytecode::RaiseAssertionErrorWithMessage:
             case Bytecode::RaiseUnwind:
+            case Bytecode::ReraiseUnwind:
                 effects.source_accumulator();
                 break;
             case Bytecode::RaiseUnwindWithContext:
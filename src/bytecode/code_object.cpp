@@ -6,6 +6,7 @@
 #include "runtime/virtual_machine.h"
 
 #include <cassert>
+#include <set>
 
 namespace cl
 {
@@ -58,6 +59,78 @@ namespace cl
         code_object->~CodeObject();
     }
 
+    void CodeObject::build_exception_handler_index()
+    {
+        exception_handler_index.clear();
+
+        std::vector<uint32_t> boundaries;
+        std::vector<uint32_t> by_start;
+        for(uint32_t idx = 0; idx < exception_table.size(); ++idx)
+        {
+            const ExceptionTableEntry &entry = exception_table[idx];
+            if(entry.start_pc >= entry.end_pc)
+            {
+                continue;
+            }
+            boundaries.push_back(entry.start_pc);
+            boundaries.push_back(entry.end_pc);
+            by_start.push_back(idx);
+        }
+        std::sort(boundaries.begin(), boundaries.end());
+        boundaries.erase(std::unique(boundaries.begin(), boundaries.end()),
+                         boundaries.end());
+
+        std::vector<uint32_t> by_end = by_start;
+        std::sort(by_start.begin(), by_start.end(),
+                  [this](uint32_t a, uint32_t b) {
+                      return exception_table[a].start_pc <
+                             exception_table[b].start_pc;
+                  });
+        std::sort(by_end.begin(), by_end.end(), [this](uint32_t a, uint32_t b) {
+            return exception_table[a].end_pc < exception_table[b].end_pc;
+        });
+
+        // Sweep the boundaries keeping the set of covering entries. The
+        // linear scan this replaces returned the first covering entry in table
+        // order, which is the innermost one because ranges are appended as
+        // they close, so each range keeps the lowest covering index.
+        std::set<uint32_t> active;
+        size_t next_start = 0;
+        size_t next_end = 0;
+        for(size_t idx = 0; idx + 1 < boundaries.size(); ++idx)
+        {
+            uint32_t start_pc = boundaries[idx];
+            uint32_t end_pc = boundaries[idx + 1];
+            while(next_end < by_end.size() &&
+                  exception_table[by_end[next_end]].end_pc == start_pc)
+            {
+                active.erase(by_end[next_end++]);
+            }
+            while(next_start < by_start.size() &&
+                  exception_table[by_start[next_start]].start_pc == start_pc)
+            {
+                active.insert(by_start[next_start++]);
+            }
+            if(active.empty())
+            {
+                continue;
+            }
+
+            uint32_t entry_idx = *active.begin();
+            if(!exception_handler_index.empty() &&
+               exception_handler_index.back().end_pc == start_pc &&
+               exception_handler_index.back().entry_idx == entry_idx)
+            {
+                exception_handler_index.back().end_pc = end_pc;
+            }
+            else
+            {
+                exception_handler_index.push_back(
+                    ExceptionHandlerRange{start_pc, end_pc, entry_idx});
+            }
+        }
+    }
+
     void CodeObject::publish_jit_code(jit::JitCodeObject *object)
     {
         assert(object != nullptr);
@@ -205,6 +205,13 @@ namespace cl
         TrustedResolution (*)(VirtualMachine *, ShapeKey, ShapeKey,
                               TrustedHandlerOperandOrder, TrustedHandlerArity);
 
+    // Function specialization resolvers see the argument count and the shape
+    // keys of the first `specialization_prefix_length` positional arguments.
+    // Shape keys past the prefix or past the argument count are invalid.
+    static constexpr uint32_t max_function_specialization_prefix_length = 2;
+    using FunctionSpecializationResolver =
+        TrustedResolution (*)(VirtualMachine *, uint32_t, ShapeKey, ShapeKey);
+
     union NativeFunctionTarget
     {
         IntrinsicFunction0 fixed0;
@@ -236,6 +243,10 @@ namespace cl
         FixedArity,
         Defaultable,
         Full,
+        // The call runs `specialized_handler` on the caller's argument
+        // registers while the guarded argument shapes match. Entering the
+        // complete function recomputes the ordinary adaptation.
+        Specialized,
     };
 
     struct FunctionCallInlineCache
@@ -246,6 +257,23 @@ namespace cl
         ValidityCell *validity_cell = nullptr;
         uint32_t n_args = UINT32_MAX;
         FunctionCallAdaptation adaptation = FunctionCallAdaptation::FixedArity;
+        uint8_t n_specialization_guards = 0;
+        ShapeKey
+            specialization_shape_keys[max_function_specialization_prefix_length];
+        TrustedHandler specialized_handler;
+
+        ALWAYSINLINE bool specialization_matches(const Value *first_arg) const
+        {
+            for(uint32_t idx = 0; idx < n_specialization_guards; ++idx)
+            {
+                if(specialization_shape_keys[idx] !=
+                   ShapeKey::from_value(first_arg[-int32_t(idx)]))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
     };
 
     struct OperatorInlineCache
@@ -451,6 +479,16 @@ namespace cl
         uint32_t handler_pc;
     };
 
+    // One disjoint, non-empty pc range of the exception handler index, naming
+    // the innermost exception table entry that covers it. Ranges are sorted by
+    // start_pc; pcs not covered by any entry have no range.
+    struct ExceptionHandlerRange
+    {
+        uint32_t start_pc;
+        uint32_t end_pc;
+        uint32_t entry_idx;
+    };
+
     struct InlineCacheTables
     {
         void clear();
@@ -558,7 +596,13 @@ namespace cl
         InlineCacheTables inline_caches;
         std::vector<NativeFunctionTarget> native_function_targets;
         std::vector<ExceptionTableEntry> exception_table;
+        std::vector<ExceptionHandlerRange> exception_handler_index;
         TrustedHandlerResolver trusted_handler_resolver = nullptr;
+        FunctionSpecializationResolver specialization_resolver = nullptr;
+        uint8_t specialization_prefix_length = 0;
+        // Adapter and thunk frames stay visible to the unwinder but are left
+        // out of user-visible tracebacks.
+        bool hide_from_traceback = false;
 
         uint32_t get_n_registers() const
         {
@@ -640,17 +684,29 @@ namespace cl
             return code.data() + offset;
         }
 
+        // Flattens the exception table into exception_handler_index. Called
+        // once the table's pcs are final.
+        void build_exception_handler_index();
+
         ALWAYSINLINE const ExceptionTableEntry *
         find_exception_handler(uint32_t pc_offset) const
         {
-            for(const ExceptionTableEntry &entry: exception_table)
+            auto range = std::upper_bound(
+                exception_handler_index.begin(), exception_handler_index.end(),
+                pc_offset,
+                [](uint32_t pc, const ExceptionHandlerRange &candidate) {
+                    return pc < candidate.start_pc;
+                });
+            if(range == exception_handler_index.begin())
             {
-                if(pc_offset >= entry.start_pc && pc_offset < entry.end_pc)
-                {
-                    return &entry;
-                }
+                return nullptr;
+            }
+            --range;
+            if(pc_offset >= range->end_pc)
+            {
+                return nullptr;
             }
-            return nullptr;
+            return &exception_table[range->entry_idx];
         }
 
         static void dealloc(HeapObject *obj);
@@ -669,6 +725,19 @@ namespace cl
         code_object.trusted_handler_resolver = &Resolver::resolve;
     }
 
+    template <typename Resolver>
+    void install_function_specialization_resolver(VirtualMachine &vm,
+                                                  CodeObject &code_object)
+    {
+        static_assert(std::is_same_v<decltype(&Resolver::resolve),
+                                     FunctionSpecializationResolver>);
+        static_assert(Resolver::prefix_length <=
+                      max_function_specialization_prefix_length);
+        Resolver::register_handlers(vm);
+        code_object.specialization_resolver = &Resolver::resolve;
+        code_object.specialization_prefix_length = Resolver::prefix_length;
+    }
+
     BuiltinClassDefinition make_code_object_class(VirtualMachine *vm);
 
 }  // namespace cl
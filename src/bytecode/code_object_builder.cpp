@@ -510,6 +510,12 @@ namespace cl
         return emit_opcode(source_offset, Bytecode::RaiseBare);
     }
 
+    Expected<uint32_t>
+    CodeObjectBuilder::emit_reraise_unwind(uint32_t source_offset)
+    {
+        return emit_opcode(source_offset, Bytecode::ReraiseUnwind);
+    }
+
     Expected<uint32_t>
     CodeObjectBuilder::emit_write_stdout(uint32_t source_offset)
     {
@@ -572,6 +578,25 @@ namespace cl
                                      first_reg, n_entries);
     }
 
+    Expected<uint32_t>
+    CodeObjectBuilder::emit_concat_unpack_args(uint32_t source_offset,
+                                               uint32_t first_reg,
+                                               uint8_t n_segments)
+    {
+        return emit_opcode_reg_range(source_offset, Bytecode::ConcatUnpackArgs,
+                                     first_reg, n_segments);
+    }
+
+    Expected<uint32_t>
+    CodeObjectBuilder::emit_merge_unpack_kwargs(uint32_t source_offset,
+                                                uint32_t first_reg,
+                                                uint8_t n_mappings)
+    {
+        return emit_opcode_reg_range(source_offset,
+                                     Bytecode::MergeUnpackKwargs, first_reg,
+                                     n_mappings);
+    }
+
     Expected<uint32_t>
     CodeObjectBuilder::emit_create_binary_slice(uint32_t source_offset,
                                                 uint32_t start_reg)
@@ -611,6 +636,17 @@ namespace cl
             cache_idx);
     }
 
+    Expected<uint32_t>
+    CodeObjectBuilder::emit_load_method_attr(uint32_t source_offset,
+                                             uint32_t receiver_reg,
+                                             uint8_t name_idx)
+    {
+        uint8_t cache_idx = CL_TRY(allocate_attribute_read_cache());
+        return emit_opcode_reg_constant_idx_cache_idx(
+            source_offset, Bytecode::LoadMethodAttr, receiver_reg, name_idx,
+            cache_idx);
+    }
+
     Expected<uint32_t>
     CodeObjectBuilder::emit_store_attr(uint32_t source_offset,
                                        uint32_t receiver_reg, uint8_t name_idx)
@@ -1085,6 +1121,25 @@ namespace cl
         return Expected<uint32_t>::ok(result);
     }
 
+    Expected<uint32_t> CodeObjectBuilder::emit_call_global_simple(
+        uint32_t source_offset, uint8_t name_idx, uint32_t callable_reg,
+        uint32_t first_arg_reg, uint8_t argc)
+    {
+        assert_call_args_are_topmost(first_arg_reg,
+                                     std::max<uint32_t>(argc, 1));
+        uint32_t result =
+            emplace_back(source_offset, uint8_t(Bytecode::CallGlobalSimple));
+        uint8_t global_cache_idx = CL_TRY(allocate_module_global_read_cache());
+        uint8_t call_cache_idx = CL_TRY(allocate_function_call_cache());
+        emplace_back(source_offset, name_idx);
+        emplace_back(source_offset, global_cache_idx);
+        emplace_back(source_offset, encode_reg(callable_reg));
+        emplace_back(source_offset, encode_reg(first_arg_reg));
+        emplace_back(source_offset, argc);
+        emplace_back(source_offset, call_cache_idx);
+        return Expected<uint32_t>::ok(result);
+    }
+
     Expected<uint32_t> CodeObjectBuilder::emit_call_keyword(
         uint32_t source_offset, uint32_t callable_reg, uint32_t first_arg_reg,
         uint8_t n_pos_args, uint32_t first_kw_value_reg, uint8_t n_kw_args,
@@ -1105,6 +1160,33 @@ namespace cl
         return Expected<uint32_t>::ok(result);
     }
 
+    Expected<uint32_t> CodeObjectBuilder::emit_call_unpack(
+        uint32_t source_offset, uint32_t callable_reg, uint32_t self_reg,
+        uint32_t args_reg)
+    {
+        uint32_t result =
+            emplace_back(source_offset, uint8_t(Bytecode::CallUnpack));
+        uint8_t cache_idx = CL_TRY(allocate_function_call_cache());
+        emplace_back(source_offset, encode_reg(callable_reg));
+        emplace_back(source_offset, encode_reg(self_reg));
+        emplace_back(source_offset, encode_reg(args_reg));
+        emplace_back(source_offset, cache_idx);
+        return Expected<uint32_t>::ok(result);
+    }
+
+    Expected<uint32_t> CodeObjectBuilder::emit_call_unpack_keyword(
+        uint32_t source_offset, uint32_t callable_reg, uint32_t self_reg,
+        uint32_t args_reg, uint32_t kwargs_reg)
+    {
+        uint32_t result =
+            emplace_back(source_offset, uint8_t(Bytecode::CallUnpackKeyword));
+        emplace_back(source_offset, encode_reg(callable_reg));
+        emplace_back(source_offset, encode_reg(self_reg));
+        emplace_back(source_offset, encode_reg(args_reg));
+        emplace_back(source_offset, encode_reg(kwargs_reg));
+        return Expected<uint32_t>::ok(result);
+    }
+
     Expected<uint8_t> CodeObjectBuilder::allocate_constant(Value val)
     {
         uint64_t raw_value = uint64_t(val.as.integer);
@@ -1180,6 +1262,7 @@ namespace cl
             ++first_free_arg_reg;
         }
         code_obj->first_free_arg_encoded_reg = encode_reg(first_free_arg_reg);
+        code_obj->build_exception_handler_index();
         finalized = true;
         return Expected<CodeObject *>::ok(code_obj);
     }
@@ -1493,6 +1576,7 @@ namespace cl
     void CodeObjectBuilder::set_exception_table_start_pc(uint32_t entry_idx,
                                                          uint32_t pc)
     {
+        assert_not_finalized();
         assert(entry_idx < code_obj->exception_table.size());
         code_obj->exception_table[entry_idx].start_pc = pc;
     }
@@ -1500,6 +1584,7 @@ namespace cl
     void CodeObjectBuilder::set_exception_table_end_pc(uint32_t entry_idx,
                                                        uint32_t pc)
     {
+        assert_not_finalized();
         assert(entry_idx < code_obj->exception_table.size());
         code_obj->exception_table[entry_idx].end_pc = pc;
     }
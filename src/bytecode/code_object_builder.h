@@ -330,6 +330,7 @@ namespace cl
         emit_raise_unwind_with_context(uint32_t source_offset,
                                        uint32_t context_reg);
         Expected<uint32_t> emit_raise_bare(uint32_t source_offset);
+        Expected<uint32_t> emit_reraise_unwind(uint32_t source_offset);
         Expected<uint32_t> emit_write_stdout(uint32_t source_offset);
         Expected<uint32_t>
         emit_create_instance_known_class(uint32_t source_offset,
@@ -349,6 +350,12 @@ namespace cl
         Expected<uint32_t> emit_create_dict(uint32_t source_offset,
                                             uint32_t first_reg,
                                             uint8_t n_entries);
+        Expected<uint32_t> emit_concat_unpack_args(uint32_t source_offset,
+                                                   uint32_t first_reg,
+                                                   uint8_t n_segments);
+        Expected<uint32_t> emit_merge_unpack_kwargs(uint32_t source_offset,
+                                                    uint32_t first_reg,
+                                                    uint8_t n_mappings);
         Expected<uint32_t> emit_create_binary_slice(uint32_t source_offset,
                                                     uint32_t start_reg);
         Expected<uint32_t> emit_create_ternary_slice(uint32_t source_offset,
@@ -360,6 +367,9 @@ namespace cl
         Expected<uint32_t> emit_load_attr(uint32_t source_offset,
                                           uint32_t receiver_reg,
                                           uint8_t name_idx);
+        Expected<uint32_t> emit_load_method_attr(uint32_t source_offset,
+                                                 uint32_t receiver_reg,
+                                                 uint8_t name_idx);
         Expected<uint32_t> emit_store_attr(uint32_t source_offset,
                                            uint32_t receiver_reg,
                                            uint8_t name_idx);
@@ -480,11 +490,25 @@ namespace cl
                                                 uint32_t callable_reg,
                                                 uint32_t first_arg_reg,
                                                 uint8_t argc);
+        Expected<uint32_t> emit_call_global_simple(uint32_t source_offset,
+                                                   uint8_t name_idx,
+                                                   uint32_t callable_reg,
+                                                   uint32_t first_arg_reg,
+                                                   uint8_t argc);
         Expected<uint32_t>
         emit_call_keyword(uint32_t source_offset, uint32_t callable_reg,
                           uint32_t first_arg_reg, uint8_t n_pos_args,
                           uint32_t first_kw_value_reg, uint8_t n_kw_args,
                           uint8_t keyword_names_idx);
+        Expected<uint32_t> emit_call_unpack(uint32_t source_offset,
+                                            uint32_t callable_reg,
+                                            uint32_t self_reg,
+                                            uint32_t args_reg);
+        Expected<uint32_t> emit_call_unpack_keyword(uint32_t source_offset,
+                                                    uint32_t callable_reg,
+                                                    uint32_t self_reg,
+                                                    uint32_t args_reg,
+                                                    uint32_t kwargs_reg);
         uint32_t add_exception_table_entry(JumpTarget &start, JumpTarget &end,
                                            JumpTarget &handler);
         uint32_t add_exception_table_entry(uint32_t start_pc, uint32_t end_pc,
@@ -407,6 +407,7 @@ template <> struct fmt::formatter<cl::CodeObject>
                 break;
 
             case cl::Bytecode::LoadAttr:
+            case cl::Bytecode::LoadMethodAttr:
                 fmt::format_to(out, " ");
                 disassemble_reg(code_obj, out, pc++);
                 fmt::format_to(out, ", ");
@@ -713,6 +714,26 @@ template <> struct fmt::formatter<cl::CodeObject>
                 }
                 break;
 
+            case cl::Bytecode::CallGlobalSimple:
+                {
+                    fmt::format_to(out, " ");
+                    disassemble_constant(code_obj, out, pc++);
+                    fmt::format_to(out, ", ");
+                    disassemble_module_global_read_cache(code_obj, out, pc++);
+                    fmt::format_to(out, ", ");
+                    int8_t callable_reg = code_obj.code[pc++];
+                    int8_t first_arg_reg = code_obj.code[pc++];
+                    uint8_t n_args = code_obj.code[pc++];
+                    uint32_t cache_idx_offset = pc++;
+                    print_reg(out, code_obj, callable_reg);
+                    fmt::format_to(out, ", ");
+                    print_reg_span(out, code_obj, first_arg_reg, n_args);
+                    fmt::format_to(out, ", ");
+                    disassemble_function_call_cache(code_obj, out,
+                                                    cache_idx_offset);
+                }
+                break;
+
             case cl::Bytecode::CallKeyword:
                 {
                     fmt::format_to(out, " ");
@@ -748,6 +769,28 @@ template <> struct fmt::formatter<cl::CodeObject>
                 }
                 break;
 
+            case cl::Bytecode::CallUnpack:
+                fmt::format_to(out, " ");
+                disassemble_reg(code_obj, out, pc++);
+                fmt::format_to(out, ", self=");
+                disassemble_reg(code_obj, out, pc++);
+                fmt::format_to(out, ", args=");
+                disassemble_reg(code_obj, out, pc++);
+                fmt::format_to(out, ", ");
+                disassemble_function_call_cache(code_obj, out, pc++);
+                break;
+
+            case cl::Bytecode::CallUnpackKeyword:
+                fmt::format_to(out, " ");
+                disassemble_reg(code_obj, out, pc++);
+                fmt::format_to(out, ", self=");
+                disassemble_reg(code_obj, out, pc++);
+                fmt::format_to(out, ", args=");
+                disassemble_reg(code_obj, out, pc++);
+                fmt::format_to(out, ", kwargs=");
+                disassemble_reg(code_obj, out, pc++);
+                break;
+
             case cl::Bytecode::CallIntrinsic0:
             case cl::Bytecode::CallIntrinsic1:
             case cl::Bytecode::CallIntrinsic2:
@@ -806,6 +849,8 @@ template <> struct fmt::formatter<cl::CodeObject>
 
             case cl::Bytecode::CreateList:
             case cl::Bytecode::CreateTuple:
+            case cl::Bytecode::ConcatUnpackArgs:
+            case cl::Bytecode::MergeUnpackKwargs:
                 fmt::format_to(out, " ");
                 disassemble_reg_span(code_obj, out, pc);
                 pc += 2;
@@ -865,6 +910,7 @@ template <> struct fmt::formatter<cl::CodeObject>
             case cl::Bytecode::RaiseAssertionErrorWithMessage:
             case cl::Bytecode::RaiseUnwind:
             case cl::Bytecode::RaiseBare:
+            case cl::Bytecode::ReraiseUnwind:
                 break;
             case cl::Bytecode::RaiseUnwindWithContext:
                 fmt::format_to(out, " ");
@@ -55,6 +55,8 @@ namespace cl
         PARAMETER_KWARGS,
         CALL_ARGUMENT_POSITIONAL,
         CALL_ARGUMENT_KEYWORD,
+        CALL_ARGUMENT_STARRED,
+        CALL_ARGUMENT_DOUBLE_STARRED,
         EXPRESSION_TUPLE,
         EXPRESSION_LIST,
         EXPRESSION_DICT,
@@ -112,6 +114,8 @@ namespace cl
             case AstNodeKind::PARAMETER_KWARGS:
             case AstNodeKind::CALL_ARGUMENT_POSITIONAL:
             case AstNodeKind::CALL_ARGUMENT_KEYWORD:
+            case AstNodeKind::CALL_ARGUMENT_STARRED:
+            case AstNodeKind::CALL_ARGUMENT_DOUBLE_STARRED:
                 return false;
             case AstNodeKind::EXPRESSION_TUPLE:
             case AstNodeKind::EXPRESSION_LIST:
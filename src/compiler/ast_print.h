@@ -332,6 +332,18 @@ template <> struct fmt::formatter<cl::AstVector>
                             cl::ExpressionPrecedence::Lowest);
                 break;
 
+            case cl::AstNodeKind::CALL_ARGUMENT_STARRED:
+                fmt::format_to(out, "*");
+                render_node(av, out, children[0], indent,
+                            cl::ExpressionPrecedence::Lowest);
+                break;
+
+            case cl::AstNodeKind::CALL_ARGUMENT_DOUBLE_STARRED:
+                fmt::format_to(out, "**");
+                render_node(av, out, children[0], indent,
+                            cl::ExpressionPrecedence::Lowest);
+                break;
+
             case cl::AstNodeKind::PARAMETER_SIGNATURE:
                 {
                     fmt::format_to(out, "(");
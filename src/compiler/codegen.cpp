@@ -977,13 +977,40 @@ namespace cl
         {
             AstNodeKind node_kind = av.kinds[node_idx].node_kind;
             if(node_kind == AstNodeKind::CALL_ARGUMENT_POSITIONAL ||
-               node_kind == AstNodeKind::CALL_ARGUMENT_KEYWORD)
+               node_kind == AstNodeKind::CALL_ARGUMENT_KEYWORD ||
+               node_kind == AstNodeKind::CALL_ARGUMENT_STARRED ||
+               node_kind == AstNodeKind::CALL_ARGUMENT_DOUBLE_STARRED)
             {
                 return av.children[node_idx][0];
             }
             return node_idx;
         }
 
+        bool is_starred_call_argument(int32_t node_idx) const
+        {
+            return av.kinds[node_idx].node_kind ==
+                   AstNodeKind::CALL_ARGUMENT_STARRED;
+        }
+
+        bool is_double_starred_call_argument(int32_t node_idx) const
+        {
+            return av.kinds[node_idx].node_kind ==
+                   AstNodeKind::CALL_ARGUMENT_DOUBLE_STARRED;
+        }
+
+        bool has_unpacked_call_argument(AstChildren args) const
+        {
+            for(int32_t arg: args)
+            {
+                if(is_starred_call_argument(arg) ||
+                   is_double_starred_call_argument(arg))
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
         uint32_t n_keyword_call_arguments(AstChildren args) const
         {
             uint32_t n_keywords = 0;
@@ -997,6 +1024,59 @@ namespace cl
             return n_keywords;
         }
 
+        // CallGlobalSimple reads the callee global after the arguments have
+        // been evaluated, while Python loads the callee first. Only fuse
+        // calls whose arguments are literals, definitely bound locals, and
+        // operators over them, so the reordering is only visible through
+        // user-defined operator methods (see doc/python-deviations.md).
+        bool is_order_insensitive_call_argument(int32_t node_idx) const
+        {
+            AstKind kind = av.kinds[node_idx];
+            switch(kind.node_kind)
+            {
+                case AstNodeKind::EXPRESSION_LITERAL:
+                    return true;
+                case AstNodeKind::EXPRESSION_VARIABLE_REFERENCE:
+                    {
+                        const NameAccessAnalysis &access =
+                            load_access(node_idx);
+                        return access.scope == BindingScope::Local &&
+                               access.presence == Presence::Present;
+                    }
+                case AstNodeKind::EXPRESSION_UNARY:
+                    return is_order_insensitive_call_argument(
+                        av.children[node_idx][0]);
+                case AstNodeKind::EXPRESSION_BINARY:
+                    return kind.operator_kind != AstOperatorKind::SUBSCRIPT &&
+                           is_order_insensitive_call_argument(
+                               av.children[node_idx][0]) &&
+                           is_order_insensitive_call_argument(
+                               av.children[node_idx][1]);
+                default:
+                    return false;
+            }
+        }
+
+        bool can_fuse_global_call(int32_t callee_idx, AstChildren args) const
+        {
+            if(av.kinds[callee_idx].node_kind !=
+                   AstNodeKind::EXPRESSION_VARIABLE_REFERENCE ||
+               load_access(callee_idx).scope != BindingScope::Global)
+            {
+                return false;
+            }
+            for(int32_t arg: args)
+            {
+                if(is_keyword_call_argument(arg) ||
+                   !is_order_insensitive_call_argument(
+                       call_argument_value(arg)))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
         Expected<void>
         require_positional_call_arguments(AstChildren args,
                                           const wchar_t *helper_name) const
@@ -1205,6 +1285,271 @@ namespace cl
             __builtin_unreachable();
         }
 
+        // Positional arguments of an unpack call, split into segments: each
+        // `*value` is one segment and each run of plain positional arguments
+        // is packed into one tuple segment. A lone segment is passed through
+        // as is, so `f(*args)` forwards the caller's tuple without copying it.
+        Expected<void>
+        codegen_unpack_call_positional_arguments(uint32_t source_offset,
+                                                 AstChildren args,
+                                                 uint32_t args_reg)
+        {
+            uint32_t n_segments = 0;
+            bool in_run = false;
+            for(int32_t arg: args)
+            {
+                if(is_starred_call_argument(arg))
+                {
+                    ++n_segments;
+                    in_run = false;
+                }
+                else if(is_positional_call_argument(arg) && !in_run)
+                {
+                    ++n_segments;
+                    in_run = true;
+                }
+            }
+            if(n_segments > UINT8_MAX)
+            {
+                return Expected<void>::raise_exception(
+                    L"SyntaxError", L"too many argument segments in call");
+            }
+            if(n_segments == 0)
+            {
+                CL_TRY(code_obj->emit_create_tuple(source_offset, args_reg, 0));
+                CL_TRY(code_obj->emit_star(source_offset, args_reg));
+                return Expected<void>::ok();
+            }
+
+            TemporaryReg segment_regs(*code_obj, n_segments);
+            uint32_t segment_idx = 0;
+            size_t arg_idx = 0;
+            while(arg_idx < args.size())
+            {
+                int32_t arg = args[arg_idx];
+                uint32_t target_reg =
+                    n_segments == 1 ? args_reg : segment_regs + segment_idx;
+                if(is_starred_call_argument(arg))
+                {
+                    CL_TRY(codegen_node_into_specific_register(
+                        call_argument_value(arg), target_reg));
+                    ++segment_idx;
+                    ++arg_idx;
+                    continue;
+                }
+                if(!is_positional_call_argument(arg))
+                {
+                    ++arg_idx;
+                    continue;
+                }
+
+                size_t run_end = arg_idx;
+                while(run_end < args.size() &&
+                      (is_positional_call_argument(args[run_end]) ||
+                       is_keyword_call_argument(args[run_end]) ||
+                       is_double_starred_call_argument(args[run_end])))
+                {
+                    ++run_end;
+                }
+                uint32_t n_run_args = 0;
+                for(size_t idx = arg_idx; idx < run_end; ++idx)
+                {
+                    if(is_positional_call_argument(args[idx]))
+                    {
+                        ++n_run_args;
+                    }
+                }
+                TemporaryReg run_regs(*code_obj, n_run_args);
+                n_run_args = 0;
+                for(size_t idx = arg_idx; idx < run_end; ++idx)
+                {
+                    if(is_positional_call_argument(args[idx]))
+                    {
+                        CL_TRY(codegen_node_into_specific_register(
+                            call_argument_value(args[idx]),
+                            run_regs + n_run_args));
+                        ++n_run_args;
+                    }
+                }
+                CL_TRY(code_obj->emit_create_tuple(source_offset, run_regs,
+                                                   n_run_args));
+                CL_TRY(code_obj->emit_star(source_offset, target_reg));
+                ++segment_idx;
+                arg_idx = run_end;
+            }
+            assert(segment_idx == n_segments);
+
+            if(n_segments > 1)
+            {
+                CL_TRY(code_obj->emit_concat_unpack_args(
+                    source_offset, segment_regs, uint8_t(n_segments)));
+                CL_TRY(code_obj->emit_star(source_offset, args_reg));
+            }
+            return Expected<void>::ok();
+        }
+
+        // Keyword counterpart of the positional segments above: each
+        // `**mapping` is one segment and each run of `name=value` arguments
+        // becomes one dict segment.
+        Expected<void>
+        codegen_unpack_call_keyword_arguments(uint32_t source_offset,
+                                              AstChildren args,
+                                              uint32_t kwargs_reg)
+        {
+            uint32_t n_segments = 0;
+            bool in_run = false;
+            for(int32_t arg: args)
+            {
+                if(is_double_starred_call_argument(arg))
+                {
+                    ++n_segments;
+                    in_run = false;
+                }
+                else if(is_keyword_call_argument(arg) && !in_run)
+                {
+                    ++n_segments;
+                    in_run = true;
+                }
+            }
+            assert(n_segments > 0);
+            if(n_segments > UINT8_MAX)
+            {
+                return Expected<void>::raise_exception(
+                    L"SyntaxError", L"too many argument segments in call");
+            }
+
+            TemporaryReg segment_regs(*code_obj, n_segments);
+            uint32_t segment_idx = 0;
+            size_t arg_idx = 0;
+            while(arg_idx < args.size())
+            {
+                int32_t arg = args[arg_idx];
+                uint32_t target_reg =
+                    n_segments == 1 ? kwargs_reg : segment_regs + segment_idx;
+                if(is_double_starred_call_argument(arg))
+                {
+                    CL_TRY(codegen_node_into_specific_register(
+                        call_argument_value(arg), target_reg));
+                    ++segment_idx;
+                    ++arg_idx;
+                    continue;
+                }
+                if(!is_keyword_call_argument(arg))
+                {
+                    ++arg_idx;
+                    continue;
+                }
+
+                size_t run_end = arg_idx;
+                while(run_end < args.size() &&
+                      !is_double_starred_call_argument(args[run_end]))
+                {
+                    ++run_end;
+                }
+                uint32_t n_run_args = 0;
+                for(size_t idx = arg_idx; idx < run_end; ++idx)
+                {
+                    if(is_keyword_call_argument(args[idx]))
+                    {
+                        ++n_run_args;
+                    }
+                }
+                TemporaryReg run_regs(*code_obj, 2 * n_run_args);
+                n_run_args = 0;
+                for(size_t idx = arg_idx; idx < run_end; ++idx)
+                {
+                    if(!is_keyword_call_argument(args[idx]))
+                    {
+                        continue;
+                    }
+                    uint8_t name_idx = CL_TRY(
+                        code_obj->allocate_constant(av.constants[args[idx]]));
+                    CL_TRY(
+                        code_obj->emit_lda_constant(source_offset, name_idx));
+                    CL_TRY(code_obj->emit_star(source_offset,
+                                               run_regs + 2 * n_run_args));
+                    CL_TRY(codegen_node_into_specific_register(
+                        call_argument_value(args[idx]),
+                        run_regs + 2 * n_run_args + 1));
+                    ++n_run_args;
+                }
+                CL_TRY(code_obj->emit_create_dict(source_offset, run_regs,
+                                                  n_run_args));
+                CL_TRY(code_obj->emit_star(source_offset, target_reg));
+                ++segment_idx;
+                arg_idx = run_end;
+            }
+            assert(segment_idx == n_segments);
+
+            if(n_segments > 1)
+            {
+                CL_TRY(code_obj->emit_merge_unpack_kwargs(
+                    source_offset, segment_regs, uint8_t(n_segments)));
+                CL_TRY(code_obj->emit_star(source_offset, kwargs_reg));
+            }
+            return Expected<void>::ok();
+        }
+
+        // Calls with `*args` or `**kwargs` arguments. Positional arguments are
+        // gathered into one list or tuple and keyword arguments into one dict;
+        // CallUnpack then spreads them straight into the callee's parameter
+        // slots. Method calls look the method up before evaluating the
+        // arguments, as the fused method-call opcodes do.
+        Expected<void> codegen_unpack_call(int32_t node_idx)
+        {
+            AstChildren children = av.children[node_idx];
+            uint32_t source_offset = av.source_offsets[node_idx];
+            AstChildren args = av.children[children[1]];
+
+            TemporaryReg callable_reg(*code_obj);
+            TemporaryReg self_reg(*code_obj);
+            if(av.kinds[children[0]].node_kind ==
+               AstNodeKind::EXPRESSION_ATTRIBUTE)
+            {
+                AstChildren method_children = av.children[children[0]];
+                uint8_t constant_idx = CL_TRY(
+                    code_obj->allocate_constant(av.constants[children[0]]));
+                CL_TRY(codegen_node_into_specific_register(method_children[0],
+                                                           self_reg));
+                CL_TRY(code_obj->emit_load_method_attr(source_offset, self_reg,
+                                                       constant_idx));
+                CL_TRY(code_obj->emit_star(source_offset, callable_reg));
+            }
+            else
+            {
+                CL_TRY(codegen_node_into_specific_register(children[0],
+                                                           callable_reg));
+                CL_TRY(code_obj->emit_clear_local(source_offset, self_reg));
+            }
+
+            TemporaryReg args_reg(*code_obj);
+            CL_TRY(codegen_unpack_call_positional_arguments(source_offset, args,
+                                                            args_reg));
+
+            bool has_keyword_arguments = false;
+            for(int32_t arg: args)
+            {
+                if(is_keyword_call_argument(arg) ||
+                   is_double_starred_call_argument(arg))
+                {
+                    has_keyword_arguments = true;
+                }
+            }
+            if(!has_keyword_arguments)
+            {
+                CL_TRY(code_obj->emit_call_unpack(source_offset, callable_reg,
+                                                  self_reg, args_reg));
+                return Expected<void>::ok();
+            }
+
+            TemporaryReg kwargs_reg(*code_obj);
+            CL_TRY(codegen_unpack_call_keyword_arguments(source_offset, args,
+                                                         kwargs_reg));
+            CL_TRY(code_obj->emit_call_unpack_keyword(
+                source_offset, callable_reg, self_reg, args_reg, kwargs_reg));
+            return Expected<void>::ok();
+        }
+
         Expected<void> codegen_function_call(int32_t node_idx)
         {
             AstChildren children = av.children[node_idx];
@@ -1216,6 +1561,11 @@ namespace cl
                 return Expected<void>::ok();
             }
 
+            if(has_unpacked_call_argument(args))
+            {
+                return codegen_unpack_call(node_idx);
+            }
+
             if(av.kinds[children[0]].node_kind ==
                AstNodeKind::EXPRESSION_ATTRIBUTE)
             {
@@ -1291,6 +1641,25 @@ namespace cl
                 return Expected<void>::ok();
             }
 
+            if(can_fuse_global_call(children[0], args))
+            {
+                uint8_t name_idx = CL_TRY(
+                    code_obj->allocate_constant(av.constants[children[0]]));
+                TemporaryReg callable_reg(*code_obj);
+                TemporaryReg call_args(*code_obj,
+                                       std::max<size_t>(args.size(), 1),
+                                       RegisterAlignment::CallFrame);
+                for(size_t i = 0; i < args.size(); ++i)
+                {
+                    CL_TRY(codegen_node_into_specific_register(
+                        call_argument_value(args[i]), call_args + i));
+                }
+                CL_TRY(code_obj->emit_call_global_simple(
+                    source_offset, name_idx, callable_reg, call_args,
+                    args.size()));
+                return Expected<void>::ok();
+            }
+
             // function itself
             TemporaryReg callable_reg(*code_obj);
             CL_TRY(
@@ -2066,6 +2435,8 @@ namespace cl
                                        RegisterAlignment::CallFrame);
                 uint8_t class_name_idx = CL_TRY(
                     code_obj->allocate_constant(interned_string(L"__class__")));
+                uint8_t traceback_name_idx = CL_TRY(code_obj->allocate_constant(
+                    interned_string(L"__traceback__")));
 
                 CL_TRY(code_obj->emit_drain_active_exception_into(
                     source_offset, saved_exception));
@@ -2074,13 +2445,14 @@ namespace cl
                 CL_TRY(code_obj->emit_star(source_offset, call_args + 1));
                 CL_TRY(code_obj->emit_mov(source_offset, call_args + 2,
                                           saved_exception));
-                CL_TRY(code_obj->emit_lda_none(source_offset));
+                CL_TRY(code_obj->emit_load_attr(source_offset, saved_exception,
+                                                traceback_name_idx));
                 CL_TRY(code_obj->emit_star(source_offset, call_args + 3));
                 CL_TRY(emit_context_exit_call(source_offset, manager_reg,
                                               call_args));
                 CL_TRY(code_obj->emit_jump_if_true(source_offset, done_target));
                 CL_TRY(code_obj->emit_ldar(source_offset, saved_exception));
-                CL_TRY(code_obj->emit_raise_unwind(source_offset));
+                CL_TRY(code_obj->emit_reraise_unwind(source_offset));
             }
 
             CL_TRY(done_target.resolve());
@@ -2140,7 +2512,7 @@ namespace cl
                 CL_TRY(codegen_node(finally_body_idx));
                 caught_exception_regs.pop_back();
                 CL_TRY(code_obj->emit_ldar(source_offset, saved_exception));
-                CL_TRY(code_obj->emit_raise_unwind(source_offset));
+                CL_TRY(code_obj->emit_reraise_unwind(source_offset));
             }
 
             CL_TRY(done_target.resolve());
@@ -2175,7 +2547,7 @@ namespace cl
                 CL_TRY(emit_exception_handler_binding_cleanup(source_offset,
                                                               name_idx));
                 CL_TRY(code_obj->emit_ldar(source_offset, saved_exception));
-                CL_TRY(code_obj->emit_raise_unwind(source_offset));
+                CL_TRY(code_obj->emit_reraise_unwind(source_offset));
             }
 
             CL_TRY(done_target.resolve());
@@ -2541,6 +2913,8 @@ namespace cl
 
                 case AstNodeKind::CALL_ARGUMENT_POSITIONAL:
                 case AstNodeKind::CALL_ARGUMENT_KEYWORD:
+                case AstNodeKind::CALL_ARGUMENT_STARRED:
+                case AstNodeKind::CALL_ARGUMENT_DOUBLE_STARRED:
                     return Expected<void>::raise_exception(
                         L"SystemError",
                         L"call argument nodes must be lowered by call codegen");
@@ -2818,7 +3192,7 @@ namespace cl
                         }
                         CL_TRY(code_obj->emit_ldar(
                             source_offset, caught_exception_regs.back()));
-                        CL_TRY(code_obj->emit_raise_unwind(source_offset));
+                        CL_TRY(code_obj->emit_reraise_unwind(source_offset));
                     }
                     else
                     {
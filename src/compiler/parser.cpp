@@ -1299,21 +1299,34 @@ namespace cl
             AstChildren ch;
             std::unordered_set<std::wstring> keyword_names;
             bool seen_keyword = false;
+            bool seen_keyword_unpacking = false;
             while(peek() != Token::RPAR)
             {
                 if(peek() == Token::STAR)
                 {
-                    return Expected<int32_t>::raise_exception(
-                        L"SyntaxError",
-                        L"starred call arguments are not implemented yet");
+                    if(seen_keyword_unpacking)
+                    {
+                        return Expected<int32_t>::raise_exception(
+                            L"SyntaxError",
+                            L"iterable argument unpacking follows keyword "
+                            L"argument unpacking");
+                    }
+                    uint32_t star_source_pos = source_pos_and_advance();
+                    int32_t value = CL_TRY(expression());
+                    ch.push_back(ast.emplace_back(
+                        AstNodeKind::CALL_ARGUMENT_STARRED, star_source_pos,
+                        AstChildren{value}));
                 }
-                if(peek() == Token::DOUBLESTAR)
+                else if(peek() == Token::DOUBLESTAR)
                 {
-                    return Expected<int32_t>::raise_exception(
-                        L"SyntaxError",
-                        L"keyword argument unpacking is not implemented yet");
+                    uint32_t star_source_pos = source_pos_and_advance();
+                    int32_t value = CL_TRY(expression());
+                    ch.push_back(ast.emplace_back(
+                        AstNodeKind::CALL_ARGUMENT_DOUBLE_STARRED,
+                        star_source_pos, AstChildren{value}));
+                    seen_keyword_unpacking = true;
                 }
-                if(peek() == Token::NAME && peek2() == Token::EQUAL)
+                else if(peek() == Token::NAME && peek2() == Token::EQUAL)
                 {
                     uint32_t name_source_pos = source_pos_and_advance();
                     std::wstring name = std::wstring(string_for_name_token(
@@ -1334,6 +1347,13 @@ namespace cl
                 }
                 else
                 {
+                    if(seen_keyword_unpacking)
+                    {
+                        return Expected<int32_t>::raise_exception(
+                            L"SyntaxError",
+                            L"positional argument follows keyword argument "
+                            L"unpacking");
+                    }
                     if(seen_keyword)
                     {
                         return Expected<int32_t>::raise_exception(
@@ -1387,7 +1407,11 @@ namespace cl
                         std::wstring_view token = string_for_float_number_token(
                             *ast.compilation_unit, source_pos_for_token());
                         double value = parse_float_literal(token);
-                        TValue<Float> v = make_object_value<Float>(value);
+                        Value v;
+                        if(!Value::try_from_immediate_float(value, &v))
+                        {
+                            v = make_object_value<Float>(value).raw_value();
+                        }
                         return Expected<int32_t>::ok(ast.emplace_back(
                             AstKind(AstNodeKind::EXPRESSION_LITERAL,
                                     AstOperatorKind::NUMBER),
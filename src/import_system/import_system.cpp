@@ -196,6 +196,10 @@ namespace cl
                                               ->get_class(),
                                           thread->class_for_native_layout(
                                               NativeLayoutId::StopIteration));
+                case PendingExceptionKind::Class:
+                    return is_subclass_of(thread->pending_exception_class(),
+                                          thread->class_for_native_layout(
+                                              NativeLayoutId::StopIteration));
                 case PendingExceptionKind::None:
                     return false;
             }
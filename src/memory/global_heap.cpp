@@ -38,6 +38,7 @@ namespace cl
     SlabAllocator *GlobalHeap::make_new_slab(size_t actual_slab_size)
     {
         const std::lock_guard<std::mutex> lock(heap_mutex);
+        ++slab_handouts;
         if(actual_slab_size == slab_size)
         {
             SlabAllocator *cached_slab = try_take_cached_empty_slab_locked();
@@ -200,6 +201,12 @@ namespace cl
         return total;
     }
 
+    uint64_t GlobalHeap::slab_handout_count() const
+    {
+        const std::lock_guard<std::mutex> lock(heap_mutex);
+        return slab_handouts;
+    }
+
     uint64_t GlobalHeap::count_valid_objects_slow() const
     {
         const std::lock_guard<std::mutex> lock(heap_mutex);
@@ -54,7 +54,10 @@ namespace cl
         {
             static_assert(std::is_base_of_v<HeapObject, T>);
             static_assert(HasNativeObjectSize<T>::value);
-            return construct_object<T>(this, std::forward<Args>(args)...);
+            T *obj = construct_object<T>(this, std::forward<Args>(args)...);
+            // Global records are immortal, so they are never young.
+            obj->generation = HeapGeneration::Old;
+            return obj;
         }
 
         template <typename T, typename... Args>
@@ -75,6 +78,18 @@ namespace cl
         }
         uint64_t total_reclaim_blockers_for_testing() const;
         uint64_t count_valid_objects_slow() const;
+        template <typename Fn> void for_each_valid_object_slow(Fn &&fn) const
+        {
+            const std::lock_guard<std::mutex> lock(heap_mutex);
+            for(const std::unique_ptr<SlabAllocator> &slab: slabs)
+            {
+                slab->for_each_valid_object(fn);
+            }
+        }
+        // Ordinary and dedicated slabs handed to allocators so far, counting
+        // reuse of cached empty slabs. Benchmarks report it as the
+        // allocation rate.
+        uint64_t slab_handout_count() const;
         bool has_slab_for_address_for_testing(const void *ptr) const;
         size_t empty_slab_cache_size_for_testing() const;
 
@@ -95,6 +110,7 @@ namespace cl
         std::unordered_map<uintptr_t, SlabAllocator *> slab_lookup;
         size_t offset;
         size_t slab_size;
+        uint64_t slab_handouts = 0;
         std::unique_ptr<ThreadLocalHeap> global_allocator;
         std::mutex global_allocator_mutex;
     };
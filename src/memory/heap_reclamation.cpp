@@ -16,8 +16,10 @@ namespace cl
         class ReclamationContext
         {
         public:
-            ReclamationContext(GlobalHeap &heap, std::vector<HeapObject *> &zct)
-                : refcounted_heap(heap), current_zct(zct)
+            ReclamationContext(GlobalHeap &heap, ThreadLocalHeap &thread_heap,
+                               std::vector<HeapObject *> &zct)
+                : refcounted_heap(heap), thread_heap(thread_heap),
+                  current_zct(zct)
             {
             }
 
@@ -95,7 +97,7 @@ namespace cl
                 }
 
                 assert(obj->lifecycle_state == HeapLifecycleState::Normal);
-                assert(obj->refcount == 0);
+                assert(heap_object_refcount(obj) == 0);
                 obj->lifecycle_state = HeapLifecycleState::InZct;
                 current_zct.push_back(obj);
             }
@@ -108,7 +110,7 @@ namespace cl
                 }
 
                 HeapObject *child = value.as.ptr;
-                if(--child->refcount == 0)
+                if(heap_object_decref(child))
                 {
                     add_to_current_zero_count_table_if_needed(child);
                 }
@@ -134,15 +136,36 @@ namespace cl
                     refcounted_heap.slab_for_object_unlocked(obj);
                 obj->lifecycle_state = HeapLifecycleState::Dead;
                 slab->clear_valid_object(obj);
+                if(obj->native_layout_id() ==
+                       ThreadLocalHeap::RecycledCellLayout &&
+                   thread_heap.recycle_cell(obj, slab))
+                {
+                    return;
+                }
                 remember_release_candidate(slab);
             }
 
             GlobalHeap &refcounted_heap;
+            ThreadLocalHeap &thread_heap;
             std::vector<HeapObject *> &current_zct;
             absl::flat_hash_set<SlabAllocator *> release_candidate_set;
             std::vector<SlabAllocator *> release_candidates;
         };
 
+        /*
+          Epoch slabs hold every object allocated since the last
+          reclamation, and objects built in recycled cells start in the zero
+          count table, so promoting the survivors of both passes leaves no
+          Young object once every thread has been processed.
+        */
+        void promote_young_survivor(HeapObject *obj)
+        {
+            if(obj->generation == HeapGeneration::Young)
+            {
+                obj->generation = HeapGeneration::Old;
+            }
+        }
+
         void process_zero_count_table_entries(
             std::vector<HeapObject *> &zero_count_table, ThreadState &thread,
             const ReclamationRootSet &roots, ReclamationContext &context)
@@ -158,16 +181,18 @@ namespace cl
                 assert(obj != nullptr);
                 assert(obj->lifecycle_state == HeapLifecycleState::InZct);
 
-                if(obj->refcount > 0)
+                if(heap_object_refcount(obj) > 0)
                 {
                     obj->lifecycle_state = HeapLifecycleState::Normal;
+                    promote_young_survivor(obj);
                     continue;
                 }
 
-                assert(obj->refcount == 0);
+                assert(heap_object_refcount(obj) == 0);
                 if(roots.contains(obj))
                 {
                     zero_count_table[keep++] = obj;
+                    promote_young_survivor(obj);
                     continue;
                 }
                 obj->lifecycle_state = HeapLifecycleState::Reclaiming;
@@ -186,20 +211,23 @@ namespace cl
                     slab->for_each_valid_object([&zero_count_table, &roots,
                                                  &context](HeapObject *obj) {
                         assert(obj != nullptr);
-                        if(obj->refcount > 0)
+                        if(heap_object_refcount(obj) > 0)
                         {
+                            promote_young_survivor(obj);
                             return;
                         }
                         if(obj->lifecycle_state != HeapLifecycleState::Normal)
                         {
+                            promote_young_survivor(obj);
                             return;
                         }
 
-                        assert(obj->refcount == 0);
+                        assert(heap_object_refcount(obj) == 0);
                         if(roots.contains(obj))
                         {
                             obj->lifecycle_state = HeapLifecycleState::InZct;
                             zero_count_table.push_back(obj);
+                            promote_young_survivor(obj);
                             return;
                         }
 
@@ -228,6 +256,16 @@ namespace cl
         }
 
         roots.add_conservative_value(record.accumulator_or_not_present);
+
+        // Lazy traceback records name code objects of frames that have
+        // already been unwound; keep them alive until the records are
+        // materialized or dropped.
+        const TracebackRing &traceback = thread.pending_traceback();
+        for(uint32_t idx = 0; idx < traceback.size(); ++idx)
+        {
+            roots.add_conservative_value(
+                Value::from_oop(traceback.entry(idx).code_object));
+        }
     }
 
     ReclamationRootSet
@@ -241,6 +279,56 @@ namespace cl
         return roots;
     }
 
+    uint64_t count_unremembered_old_to_young_edges(const GlobalHeap &heap)
+    {
+        uint64_t count = 0;
+        auto check_edge = [&count](const HeapObject *holder,
+                                   const HeapObject *child) {
+            if(holder->generation == HeapGeneration::Old &&
+               child->generation == HeapGeneration::Young)
+            {
+                ++count;
+            }
+        };
+        heap.for_each_valid_object_slow([&check_edge](HeapObject *obj) {
+            if(!native_layout_has_slots(obj->native_layout_id()))
+            {
+                return;
+            }
+            const SlotObject *object = static_cast<const SlotObject *>(obj);
+            const OverflowSlots *overflow_slots = object->get_overflow_slots();
+            if(overflow_slots != nullptr)
+            {
+                check_edge(object, overflow_slots);
+            }
+            const Shape *shape = object->get_shape();
+            if(shape == nullptr)
+            {
+                return;
+            }
+            for(uint32_t idx = 0; idx < shape->present_count(); ++idx)
+            {
+                StorageLocation location =
+                    shape->get_property_storage_location(idx);
+                if(!location.is_found())
+                {
+                    continue;
+                }
+                const HeapObject *holder = object;
+                if(location.kind == StorageKind::Overflow)
+                {
+                    holder = overflow_slots;
+                }
+                Value value = object->read_storage_location(location);
+                if(value.is_refcounted_ptr())
+                {
+                    check_edge(holder, value.as.ptr);
+                }
+            }
+        });
+        return count;
+    }
+
 #ifndef NDEBUG
     void validate_zero_count_table_for_reclamation(const ThreadState &thread)
     {
@@ -276,8 +364,16 @@ namespace cl
         std::vector<HeapObject *> &zero_count_table = thread.zero_count_table;
         ReclamationContext reclamation_context(
             thread.get_machine()->get_refcounted_global_heap(),
-            zero_count_table);
+            thread.refcounted_heap, zero_count_table);
         ThreadState::ActivationScope active_thread(&thread);
+        // Cells nobody reused since the last reclamation go back to their
+        // slabs, so a thread that stopped boxing floats pins nothing.
+        for(const HeapAllocation &cell:
+            thread.refcounted_heap.take_recycled_cells())
+        {
+            cell.slab->drop_recycled_cell_pin();
+            reclamation_context.remember_release_candidate(cell.slab);
+        }
         process_zero_count_table_entries(zero_count_table, thread, roots,
                                          reclamation_context);
         scan_epoch_slab_bitmaps(thread.refcounted_heap, zero_count_table, roots,
@@ -297,6 +393,13 @@ namespace cl
 #ifndef NDEBUG
         validate_zero_count_tables_for_reclamation(threads);
 #endif
+        // All Young survivors are promoted below, which leaves no
+        // old-to-young edge to remember. Forget the remembered objects now,
+        // while none of them can have been reclaimed yet.
+        for(const std::unique_ptr<ThreadState> &thread: threads)
+        {
+            thread->clear_remembered_set();
+        }
         ReclamationRootSet roots =
             collect_reclamation_roots_from_threads(threads);
         for(const std::unique_ptr<ThreadState> &thread: threads)
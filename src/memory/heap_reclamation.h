@@ -12,6 +12,7 @@
 
 namespace cl
 {
+    class GlobalHeap;
     class ThreadState;
 
     inline bool value_has_refcounted_pointer_shape(Value value)
@@ -54,6 +55,12 @@ namespace cl
 #endif
     void run_heap_reclamation(const ThreadStateList &threads);
 
+    // Whole-heap check for the generational write barrier: counts slot
+    // values held by an unremembered Old object that point at a Young one.
+    // Covers attribute storage of slot objects, which is the storage the
+    // barrier instruments.
+    uint64_t count_unremembered_old_to_young_edges(const GlobalHeap &heap);
+
 }  // namespace cl
 
 #endif  // CL_HEAP_RECLAMATION_H
@@ -36,6 +36,8 @@ namespace cl
         ClassObject,
         Exception,
         StopIteration,
+        Traceback,
+        ThreadLock,
         Instance,
         Scope,
         Shape,
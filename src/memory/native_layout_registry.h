@@ -29,6 +29,8 @@
 #include "object_model/validity_cell.h"
 #include "object_model/vm_array_backing.h"
 #include "runtime/exception_object.h"
+#include "runtime/thread_module.h"
+#include "runtime/traceback.h"
 
 #define CL_NATIVE_LAYOUT_REGISTRY(V)                                           \
     V(BigInt);                                                                 \
@@ -49,6 +51,8 @@
     V(ModuleSpecObject);                                                       \
     V(ExceptionObject);                                                        \
     V(StopIterationObject);                                                    \
+    V(TracebackObject);                                                        \
+    V(ThreadLockObject);                                                       \
     V(Float);                                                                  \
     V(Function);                                                               \
     V(Dict);                                                                   \
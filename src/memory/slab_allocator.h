@@ -39,6 +39,12 @@ namespace cl
             assert(n_slab_pins > 0);
             --n_slab_pins;
         }
+        void add_recycled_cell_pin() { ++n_slab_pins; }
+        void drop_recycled_cell_pin()
+        {
+            assert(n_slab_pins > 0);
+            --n_slab_pins;
+        }
         uint32_t slab_pin_count() const { return n_slab_pins; }
 
         char *start() const { return start_ptr; }
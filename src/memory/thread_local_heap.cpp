@@ -18,7 +18,7 @@ namespace cl
     ThreadLocalHeap::~ThreadLocalHeap()
     {
         drop_active_allocator_pin(local_allocator);
-        drop_epoch_discovery_pins_and_release_slabs();
+        drop_slab_pins_and_release_slabs();
     }
 
     HeapAllocation ThreadLocalHeap::allocate_slow(size_t n_bytes)
@@ -75,10 +75,17 @@ namespace cl
             child.ordinary_inactive_slabs_since_reclamation;
         dedicated_large_bytes_since_reclamation +=
             child.dedicated_large_bytes_since_reclamation;
+        recycled_cells.insert(recycled_cells.end(),
+                              child.recycled_cells.begin(),
+                              child.recycled_cells.end());
+        recycled_cells_since_reclamation +=
+            child.recycled_cells_since_reclamation;
 
         child.epoch_slabs_since_reclamation.clear();
         child.ordinary_inactive_slabs_since_reclamation = 0;
         child.dedicated_large_bytes_since_reclamation = 0;
+        child.recycled_cells.clear();
+        child.recycled_cells_since_reclamation = 0;
     }
 
     std::vector<SlabAllocator *> ThreadLocalHeap::finish_reclamation_epoch()
@@ -128,16 +135,42 @@ namespace cl
         }
     }
 
-    void ThreadLocalHeap::drop_epoch_discovery_pins_and_release_slabs()
+    void ThreadLocalHeap::request_reclamation_if_recycled_cells_ran_out()
+    {
+        if(safepoint_requested_ptr != nullptr &&
+           recycled_cells_since_reclamation >= RecycledCellLimit / 2)
+        {
+            *safepoint_requested_ptr = true;
+        }
+    }
+
+    void ThreadLocalHeap::drop_slab_pins_and_release_slabs()
     {
         for(SlabAllocator *allocator: epoch_slabs_since_reclamation)
         {
             allocator->drop_epoch_discovery_pin();
         }
+        std::vector<SlabAllocator *> recycled_cell_slabs;
+        for(const HeapAllocation &cell: recycled_cells)
+        {
+            cell.slab->drop_recycled_cell_pin();
+            if(!owns_epoch_slab(cell.slab))
+            {
+                recycled_cell_slabs.push_back(cell.slab);
+            }
+        }
+        std::sort(recycled_cell_slabs.begin(), recycled_cell_slabs.end());
+        recycled_cell_slabs.erase(
+            std::unique(recycled_cell_slabs.begin(), recycled_cell_slabs.end()),
+            recycled_cell_slabs.end());
         for(SlabAllocator *allocator: epoch_slabs_since_reclamation)
         {
             global_heap->release_slab_if_empty(allocator);
         }
+        for(SlabAllocator *allocator: recycled_cell_slabs)
+        {
+            global_heap->release_slab_if_empty(allocator);
+        }
     }
 
     bool ThreadLocalHeap::owns_epoch_slab(SlabAllocator *allocator) const
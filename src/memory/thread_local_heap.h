@@ -7,6 +7,7 @@
 #include <cassert>
 #include <cstdint>
 #include <cstdlib>
+#include <memory>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -20,6 +21,13 @@ namespace cl
         static constexpr uint64_t ReclamationPolicyInactiveEpochSlabLimit = 8;
         static constexpr uint64_t ReclamationPolicyDedicatedLargeBytesLimit =
             DefaultSlabSize;
+        // Boxed floats are the one short-lived record the interpreter
+        // allocates at arithmetic rate, so only their cells are recycled.
+        static constexpr NativeLayoutId RecycledCellLayout =
+            NativeLayoutId::Float;
+        // Float cells round up to 32 bytes, so a full list covers as much
+        // memory as ReclamationPolicyInactiveEpochSlabLimit slabs.
+        static constexpr size_t RecycledCellLimit = 16384;
 
         ThreadLocalHeap(GlobalHeap *_global_heap,
                         bool *_safepoint_requested_ptr = nullptr);
@@ -81,6 +89,59 @@ namespace cl
             return construct_object<T>(this, std::forward<Args>(args)...);
         }
 
+        /*
+          Cells of RecycledCellLayout objects freed by the last reclamation.
+          Each one keeps its slab pinned until it is reused or dropped at the
+          next reclamation. A recycled cell lies outside the epoch slabs, so
+          the caller must queue the new object where the next reclamation
+          will look for it.
+
+          Using up a list that reclamation filled at least halfway requests
+          the next reclamation, like the slab policy does after a comparable
+          amount of fresh memory. A float-heavy loop then keeps cycling
+          through the same cells instead of moving on to fresh slabs.
+        */
+        bool recycle_cell(HeapObject *cell, SlabAllocator *slab)
+        {
+            assert(cell->native_layout_id() == RecycledCellLayout);
+            if(recycled_cells.size() >= RecycledCellLimit)
+            {
+                return false;
+            }
+            slab->add_recycled_cell_pin();
+            recycled_cells.push_back({reinterpret_cast<char *>(cell), slab});
+            ++recycled_cells_since_reclamation;
+            return true;
+        }
+        template <typename T, typename... Args>
+        T *make_in_recycled_cell(Args &&...args)
+        {
+            static_assert(T::native_layout == RecycledCellLayout);
+            static_assert(T::native_object_size_kind ==
+                          ObjectSizeKind::StaticSize);
+            if(recycled_cells.empty())
+            {
+                return nullptr;
+            }
+            HeapAllocation cell = recycled_cells.back();
+            recycled_cells.pop_back();
+            if(recycled_cells.empty())
+            {
+                request_reclamation_if_recycled_cells_ran_out();
+            }
+            T *obj = std::construct_at(reinterpret_cast<T *>(cell.memory),
+                                       std::forward<Args>(args)...);
+            cell.slab->mark_valid_object(obj);
+            cell.slab->drop_recycled_cell_pin();
+            return obj;
+        }
+        [[nodiscard]] std::vector<HeapAllocation> take_recycled_cells()
+        {
+            recycled_cells_since_reclamation = 0;
+            return std::move(recycled_cells);
+        }
+        size_t recycled_cell_count() const { return recycled_cells.size(); }
+
     private:
         NOINLINE HeapAllocation allocate_slow(size_t n_bytes);
         void add_active_allocator_pin(SlabAllocator *allocator)
@@ -96,17 +157,20 @@ namespace cl
         void remember_dedicated_epoch_slab(SlabAllocator *allocator,
                                            size_t n_bytes);
         void request_reclamation_if_policy_triggers();
+        void request_reclamation_if_recycled_cells_ran_out();
         uint64_t current_active_slab_count() const
         {
             return local_allocator == nullptr ? 0 : 1;
         }
-        void drop_epoch_discovery_pins_and_release_slabs();
+        void drop_slab_pins_and_release_slabs();
         bool owns_epoch_slab(SlabAllocator *allocator) const;
 
         GlobalHeap *global_heap;
         bool *safepoint_requested_ptr;
         SlabAllocator *local_allocator;
         std::vector<SlabAllocator *> epoch_slabs_since_reclamation;
+        std::vector<HeapAllocation> recycled_cells;
+        uint64_t recycled_cells_since_reclamation = 0;
         uint64_t ordinary_inactive_slabs_since_reclamation = 0;
         uint64_t dedicated_large_bytes_since_reclamation = 0;
     };
@@ -106,6 +106,25 @@ namespace cl
         return descriptor;
     }
 
+    static bool has_dictionary_mode_receiver(Value receiver)
+    {
+        return receiver.is_ptr() &&
+               receiver.get_ptr<Object>()->get_shape()->is_dictionary_mode();
+    }
+
+    // Dictionary-mode shapes are edited in place and freed when outgrown, so
+    // a cache keyed on one could match a different layout later.
+    template <typename Descriptor>
+    static Descriptor
+    uncacheable_dictionary_mode_receiver_descriptor(Descriptor descriptor)
+    {
+        descriptor.lookup_validity_cell = nullptr;
+        descriptor.cache_blockers = attribute_cache_blockers(
+            descriptor.cache_blockers,
+            AttributeCacheBlocker::DictionaryModeReceiver);
+        return descriptor;
+    }
+
     static AttributeReadDescriptor shape_class_value_descriptor(Value receiver)
     {
         Value class_value = Value::from_oop(
@@ -489,13 +508,64 @@ namespace cl
             metaclass_descriptor, cls);
     }
 
+    static AttributeReadDescriptor
+    resolve_object_attr_read_descriptor(Object *object, Value obj,
+                                        TValue<String> name)
+    {
+        ClassObject *class_object = object->get_shape()->get_class();
+        AttributeReadDescriptor class_descriptor =
+            classify_class_read_descriptor(
+                lookup_instance_attribute_read_descriptor(class_object, name,
+                                                          obj));
+        if(class_descriptor.is_found() &&
+           class_descriptor.plan.kind ==
+               AttributeReadPlanKind::DataDescriptorGet)
+        {
+            return with_mro_shape_and_contents_validity_cell_if_unblocked(
+                class_descriptor, class_object);
+        }
+
+        DescriptorLookup own_lookup =
+            object->get_shape()->lookup_descriptor_including_latent(name);
+        if(own_lookup.is_present() &&
+           own_lookup.info.has_flag(DescriptorFlag::SpecialRead))
+        {
+            return with_mro_shape_and_contents_validity_cell_if_unblocked(
+                with_cache_blockers(
+                    special_read_descriptor(obj, own_lookup.info),
+                    superseded_class_read_descriptor_cache_blockers(
+                        class_descriptor)),
+                class_object);
+        }
+
+        AttributeReadDescriptor own_descriptor =
+            object->lookup_own_attribute_descriptor(name);
+        if(own_descriptor.is_found())
+        {
+            return with_mro_shape_and_contents_validity_cell_if_unblocked(
+                with_cache_blockers(
+                    own_descriptor,
+                    superseded_class_read_descriptor_cache_blockers(
+                        class_descriptor)),
+                class_object);
+        }
+
+        // A class-chain hit only needs the receiver class MRO shape. Reuse the
+        // combined class-read cell instead of adding a third owned cell: it is
+        // shape-only along this MRO and merely over-invalidates on metaclass
+        // changes, which are much colder than class contents writes.
+        return with_mro_shape_and_metaclass_mro_shape_and_contents_validity_cell_if_unblocked(
+            class_descriptor, class_object);
+    }
+
     AttributeReadDescriptor resolve_attr_read_descriptor(Value obj,
                                                          TValue<String> name)
     {
         if(likely(obj.is_ptr()))
         {
             Object *object = obj.get_ptr<Object>();
-            if(object->get_shape()->has_flag(ShapeFlag::IsClassObject))
+            Shape *shape = object->get_shape();
+            if(shape->has_flag(ShapeFlag::IsClassObject))
             {
                 assert(object->native_layout_id() ==
                        NativeLayoutId::ClassObject);
@@ -503,51 +573,14 @@ namespace cl
                     static_cast<ClassObject *>(object), name);
             }
 
-            ClassObject *class_object = object->get_shape()->get_class();
-            AttributeReadDescriptor class_descriptor =
-                classify_class_read_descriptor(
-                    lookup_instance_attribute_read_descriptor(class_object,
-                                                              name, obj));
-            if(class_descriptor.is_found() &&
-               class_descriptor.plan.kind ==
-                   AttributeReadPlanKind::DataDescriptorGet)
-            {
-                return with_mro_shape_and_contents_validity_cell_if_unblocked(
-                    class_descriptor, class_object);
-            }
-
-            DescriptorLookup own_lookup =
-                object->get_shape()->lookup_descriptor_including_latent(name);
-            if(own_lookup.is_present() &&
-               own_lookup.info.has_flag(DescriptorFlag::SpecialRead))
-            {
-                return with_mro_shape_and_contents_validity_cell_if_unblocked(
-                    with_cache_blockers(
-                        special_read_descriptor(obj, own_lookup.info),
-                        superseded_class_read_descriptor_cache_blockers(
-                            class_descriptor)),
-                    class_object);
-            }
-
-            AttributeReadDescriptor own_descriptor =
-                object->lookup_own_attribute_descriptor(name);
-            if(own_descriptor.is_found())
+            AttributeReadDescriptor descriptor =
+                resolve_object_attr_read_descriptor(object, obj, name);
+            if(unlikely(shape->is_dictionary_mode()))
             {
-                return with_mro_shape_and_contents_validity_cell_if_unblocked(
-                    with_cache_blockers(
-                        own_descriptor,
-                        superseded_class_read_descriptor_cache_blockers(
-                            class_descriptor)),
-                    class_object);
+                return uncacheable_dictionary_mode_receiver_descriptor(
+                    descriptor);
             }
-
-            // A class-chain hit only needs the receiver class MRO shape. Reuse
-            // the combined class-read cell instead of adding a third owned
-            // cell: it is shape-only along this MRO and merely over-invalidates
-            // on metaclass changes, which are much colder than class contents
-            // writes.
-            return with_mro_shape_and_metaclass_mro_shape_and_contents_validity_cell_if_unblocked(
-                class_descriptor, class_object);
+            return descriptor;
         }
 
         AttributeReadDescriptor inline_shape_descriptor =
@@ -575,6 +608,10 @@ namespace cl
         {
             return uncacheable_inline_receiver_descriptor(descriptor);
         }
+        if(unlikely(has_dictionary_mode_receiver(obj)))
+        {
+            return uncacheable_dictionary_mode_receiver_descriptor(descriptor);
+        }
         return with_mro_shape_and_contents_validity_cell_if_unblocked(
             descriptor, class_object);
     }
@@ -609,6 +646,10 @@ namespace cl
         {
             return uncacheable_inline_receiver_descriptor(descriptor);
         }
+        if(unlikely(has_dictionary_mode_receiver(receiver)))
+        {
+            return uncacheable_dictionary_mode_receiver_descriptor(descriptor);
+        }
         return with_mro_shape_and_contents_validity_cell_if_unblocked(
             descriptor, receiver_class);
     }
@@ -734,6 +775,11 @@ namespace cl
 
         own_descriptor.cache_blockers |=
             superseded_class_read_descriptor_cache_blockers(class_descriptor);
+        if(unlikely(object->get_shape()->is_dictionary_mode()))
+        {
+            return uncacheable_dictionary_mode_receiver_descriptor(
+                own_descriptor);
+        }
         return with_mro_shape_and_contents_validity_cell_if_unblocked(
             own_descriptor, lookup_class);
     }
@@ -809,6 +855,12 @@ namespace cl
         assert(receiver.is_ptr());
         assert(plan.next_shape != nullptr);
         Object *object = receiver.get_ptr<Object>();
+        if(plan.next_shape == object->get_shape())
+        {
+            // Only dictionary-mode deletes keep the receiver's shape.
+            object->delete_dictionary_mode_property(plan.storage_location());
+            return true;
+        }
         object->set_shape(plan.next_shape);
         object->write_storage_location(plan.storage_location(),
                                        Value::not_present());
@@ -81,6 +81,7 @@ namespace cl
         MissingLookupCell = 1 << 2,
         UnsupportedDescriptorKind = 1 << 3,
         InlineReceiver = 1 << 4,
+        DictionaryModeReceiver = 1 << 5,
     };
 
     using AttributeCacheBlockers = uint16_t;
@@ -207,6 +207,7 @@ namespace cl
               _instance_default_inline_slot_count),
           instance_native_layout_id_(_instance_native_layout_id)
     {
+        generation = HeapGeneration::Old;
         BuiltinInstanceShapeBuilder(
             this, BuiltinInstanceShapeDefaults::DunderClassAndDict, 0)
             .install(instance_shape_flags);
@@ -319,6 +319,7 @@ namespace cl
     {
         CodeObject *code =
             CL_TRY(make_init_only_constructor_thunk_code(cls, init));
+        code->hide_from_traceback = true;
         if(!init.has_value())
         {
             return Expected<TValue<Function>>::ok(
@@ -366,6 +367,7 @@ namespace cl
     {
         CodeObject *code =
             CL_TRY(make_new_only_constructor_thunk_code(cls, new_));
+        code->hide_from_traceback = true;
         Optional<TValue<Tuple>> defaults =
             new_.extract()->default_parameters.value();
         if(!defaults.has_value())
@@ -1,8 +1,10 @@
 #ifndef CL_HEAP_OBJECT_H
 #define CL_HEAP_OBJECT_H
 
+#include "build_config.h"
 #include "memory/native_layout_id.h"
 
+#include <atomic>
 #include <cassert>
 #include <cstddef>
 #include <cstdint>
@@ -18,6 +20,32 @@ namespace cl
         Dead,
     };
 
+    /*
+      Generation of a heap record, for the generational write barrier.
+      Objects are allocated Young and promoted to Old when they survive a
+      reclamation epoch. Immortal records and class metadata start Old. An
+      Old object that was given a reference to a Young one is OldRemembered
+      and sits in its thread's remembered set until the next reclamation.
+    */
+    enum class HeapGeneration : uint8_t
+    {
+        Young,
+        Old,
+        OldRemembered,
+    };
+
+#if CL_REFCOUNT_MODE == CL_REFCOUNT_MODE_BIASED
+    /*
+      Biased refcounting: each object records the thread that allocated it.
+      That owner updates `refcount` with plain arithmetic; every other thread
+      updates `shared_refcount` atomically. The true count is the sum. A
+      non-owner decrement that leaves the shared count at or below zero queues
+      the object, and heap reclamation folds the shared count back into the
+      owner count while every mutator is stopped.
+    */
+    extern constinit thread_local uint32_t active_refcount_owner;
+#endif
+
     /*
       Base class for all VM heap records. HeapObjects have the common header
       needed for refcounting and value scanning, but are not necessarily
@@ -29,16 +57,26 @@ namespace cl
         explicit HeapObject(NativeLayoutId _native_layout_id,
                             uint16_t _native_layout_aux_count = 0)
             : refcount(0), lifecycle_state(HeapLifecycleState::Normal),
+              generation(HeapGeneration::Young),
               native_layout_id_(_native_layout_id),
               native_layout_aux_count(_native_layout_aux_count)
+#if CL_REFCOUNT_MODE == CL_REFCOUNT_MODE_BIASED
+              ,
+              owner_thread(active_refcount_owner), shared_refcount(0)
+#endif
         {
             assert(native_layout_id_ != NativeLayoutId::Invalid);
         }
 
         HeapObject()
             : refcount(0), lifecycle_state(HeapLifecycleState::Normal),
+              generation(HeapGeneration::Young),
               native_layout_id_(NativeLayoutId::Invalid),
               native_layout_aux_count(0)
+#if CL_REFCOUNT_MODE == CL_REFCOUNT_MODE_BIASED
+              ,
+              owner_thread(active_refcount_owner), shared_refcount(0)
+#endif
         {
         }
 
@@ -53,14 +91,91 @@ namespace cl
         }
 
         int32_t refcount;
-        HeapLifecycleState lifecycle_state;
+        HeapLifecycleState lifecycle_state : 4;
+        HeapGeneration generation : 4;
         NativeLayoutId native_layout_id_;
         uint16_t native_layout_aux_count;
+#if CL_REFCOUNT_MODE == CL_REFCOUNT_MODE_BIASED
+        uint32_t owner_thread;
+        int32_t shared_refcount;
+#endif
     };
 
+#if CL_REFCOUNT_MODE == CL_REFCOUNT_MODE_BIASED
+    static_assert(sizeof(HeapObject) == 16);
+#else
     static_assert(sizeof(HeapObject) == 8);
+#endif
     static_assert(std::is_trivially_destructible_v<HeapObject>);
 
+#if CL_REFCOUNT_MODE == CL_REFCOUNT_MODE_BIASED
+    void queue_shared_refcount_merge(HeapObject *obj);
+#endif
+
+    /*
+      Header refcount primitives. Callers check that the object is a
+      refcounted pointer first; immortal and interned objects never reach
+      these.
+    */
+    static inline void heap_object_incref(HeapObject *obj)
+    {
+#if CL_REFCOUNT_MODE == CL_REFCOUNT_MODE_PLAIN
+        ++obj->refcount;
+#elif CL_REFCOUNT_MODE == CL_REFCOUNT_MODE_ATOMIC
+        std::atomic_ref<int32_t>(obj->refcount)
+            .fetch_add(1, std::memory_order_relaxed);
+#else
+        if(obj->owner_thread == active_refcount_owner)
+        {
+            ++obj->refcount;
+        }
+        else
+        {
+            std::atomic_ref<int32_t>(obj->shared_refcount)
+                .fetch_add(1, std::memory_order_relaxed);
+        }
+#endif
+    }
+
+    // Returns true when the caller dropped the last reference and must hand
+    // the object to the zero count table.
+    static inline bool heap_object_decref(HeapObject *obj)
+    {
+#if CL_REFCOUNT_MODE == CL_REFCOUNT_MODE_PLAIN
+        return --obj->refcount == 0;
+#elif CL_REFCOUNT_MODE == CL_REFCOUNT_MODE_ATOMIC
+        return std::atomic_ref<int32_t>(obj->refcount)
+                   .fetch_sub(1, std::memory_order_acq_rel) == 1;
+#else
+        if(obj->owner_thread == active_refcount_owner)
+        {
+            return --obj->refcount == 0 &&
+                   std::atomic_ref<int32_t>(obj->shared_refcount)
+                           .load(std::memory_order_acquire) == 0;
+        }
+        if(std::atomic_ref<int32_t>(obj->shared_refcount)
+               .fetch_sub(1, std::memory_order_acq_rel) <= 1)
+        {
+            queue_shared_refcount_merge(obj);
+        }
+        return false;
+#endif
+    }
+
+    // The object's full count, for reclamation. Only meaningful while no other
+    // thread is mutating.
+    static inline int32_t heap_object_refcount(const HeapObject *obj)
+    {
+#if CL_REFCOUNT_MODE == CL_REFCOUNT_MODE_BIASED
+        return obj->refcount +
+               std::atomic_ref<int32_t>(
+                   const_cast<int32_t &>(obj->shared_refcount))
+                   .load(std::memory_order_acquire);
+#else
+        return obj->refcount;
+#endif
+    }
+
 }  // namespace cl
 
 #endif  // CL_HEAP_OBJECT_H
@@ -129,6 +129,20 @@ namespace cl
                 return AttributeDeleteDescriptor::read_only();
             }
 
+            if(object->uses_dictionary_mode_for(name,
+                                                ShapeTransitionVerb::Delete))
+            {
+                // The plan keeps the current shape; delete_attr_from_plan
+                // edits this object's private shape when it runs.
+                AttributeDeleteDescriptor descriptor =
+                    AttributeDeleteDescriptor::found(
+                        AttributeMutationPlan::delete_own_property(
+                            current_shape, info.storage_location()));
+                descriptor.cache_blockers = attribute_cache_blocker(
+                    AttributeCacheBlocker::DictionaryModeReceiver);
+                return descriptor;
+            }
+
             Shape *next_shape = current_shape->derive_transition(
                 name, ShapeTransitionVerb::Delete);
             return AttributeDeleteDescriptor::found(
@@ -136,6 +150,26 @@ namespace cl
                     next_shape, info.storage_location()));
         }
 
+        Shape *shape_after_adding_own_property(Object *object,
+                                               TValue<String> name,
+                                               DescriptorFlags descriptor_flags)
+        {
+            Shape *current_shape = object->get_shape();
+            if(!object->uses_dictionary_mode_for(
+                   name, ShapeTransitionVerb::Add, descriptor_flags))
+            {
+                return current_shape->derive_transition(
+                    name, ShapeTransitionVerb::Add, descriptor_flags);
+            }
+
+            Shape *dictionary_shape =
+                current_shape->is_dictionary_mode()
+                    ? current_shape
+                    : current_shape->make_dictionary_mode_copy();
+            return dictionary_shape->add_dictionary_property(name,
+                                                             descriptor_flags);
+        }
+
     }  // namespace
 
     BuiltinClassDefinition make_object_class(VirtualMachine *vm)
@@ -324,9 +358,8 @@ namespace cl
             return false;
         }
 
-        Shape *next_shape = current_shape->derive_transition(
-            name, ShapeTransitionVerb::Add,
-            descriptor_flag(DescriptorFlag::None));
+        Shape *next_shape = shape_after_adding_own_property(
+            this, name, descriptor_flag(DescriptorFlag::None));
         set_shape(next_shape);
 
         StorageLocation new_location =
@@ -352,8 +385,8 @@ namespace cl
             return false;
         }
 
-        Shape *next_shape = current_shape->derive_transition(
-            name, ShapeTransitionVerb::Add, descriptor_flags);
+        Shape *next_shape =
+            shape_after_adding_own_property(this, name, descriptor_flags);
         set_shape(next_shape);
 
         StorageLocation new_location =
@@ -406,6 +439,36 @@ namespace cl
         return delete_attr_from_plan(Value::from_oop(this), descriptor.plan);
     }
 
+    bool
+    Object::uses_dictionary_mode_for(TValue<String> name,
+                                     ShapeTransitionVerb verb,
+                                     DescriptorFlags descriptor_flags) const
+    {
+        Shape *current_shape = get_shape();
+        if(current_shape->is_dictionary_mode())
+        {
+            return true;
+        }
+        // Class and module shapes back validity cells and module global
+        // caches that expect every add or delete to mint a new shape, so only
+        // plain instances leave the transition tree.
+        return native_layout_id() == NativeLayoutId::Instance &&
+               current_shape->exceeds_fast_mode_budget(name, verb,
+                                                       descriptor_flags);
+    }
+
+    void Object::delete_dictionary_mode_property(StorageLocation location)
+    {
+        Shape *current_shape = get_shape();
+        if(!current_shape->is_dictionary_mode())
+        {
+            current_shape = current_shape->make_dictionary_mode_copy();
+            set_shape(current_shape);
+        }
+        current_shape->delete_dictionary_property(location);
+        write_storage_location(location, Value::not_present());
+    }
+
     void Object::write_storage_location(StorageLocation location, Value value)
     {
         switch(location.kind)
@@ -415,6 +478,7 @@ namespace cl
                     Value *slots = inline_slot_base();
                     Value old_value = slots[location.physical_idx];
                     slots[location.physical_idx] = incref(value);
+                    generational_write_barrier(this, value);
                     decref(old_value);
                     return;
                 }
@@ -466,6 +530,7 @@ namespace cl
                         assert(slots[physical_idx].is_not_present());
                     }
                     slots[physical_idx] = incref(value);
+                    generational_write_barrier(this, value);
                     return;
                 }
             case StorageKind::Overflow:
@@ -537,6 +602,7 @@ namespace cl
 
         OverflowSlots *old_overflow_storage = overflow_storage;
         overflow_storage = incref(new_overflow_slots);
+        generational_write_barrier_refcounted(this, new_overflow_slots);
         decref(old_overflow_storage);
         return new_overflow_slots;
     }
@@ -19,6 +19,7 @@ namespace cl
     class ClassObject;
     class OverflowSlots;
     class Shape;
+    enum class ShapeTransitionVerb : uint8_t;
     class SlotObject;
     class VirtualMachine;
     class String;
@@ -65,6 +66,13 @@ namespace cl
         bool set_existing_own_property(TValue<String> name, Value value);
         bool set_own_property(TValue<String> name, Value value);
         bool delete_own_property(TValue<String> name);
+        // Whether this add or delete should edit a private dictionary-mode
+        // shape instead of deriving a shared transition.
+        bool uses_dictionary_mode_for(
+            TValue<String> name, ShapeTransitionVerb verb,
+            DescriptorFlags descriptor_flags =
+                descriptor_flag(DescriptorFlag::None)) const;
+        void delete_dictionary_mode_property(StorageLocation location);
         Value read_storage_location(StorageLocation location) const;
         HeapObject *write_existing_storage_location_returning_zero_ref(
             StorageLocation location, Value value);
@@ -108,7 +116,8 @@ namespace cl
                native_layout == NativeLayoutId::ModuleLoaderObject ||
                native_layout == NativeLayoutId::ModuleSpecObject ||
                native_layout == NativeLayoutId::Exception ||
-               native_layout == NativeLayoutId::StopIteration;
+               native_layout == NativeLayoutId::StopIteration ||
+               native_layout == NativeLayoutId::Traceback;
     }
 
     class SlotObject : public Object
@@ -231,8 +240,8 @@ namespace cl
         return static_cast<const T *>(object);
     }
 
-    static_assert(sizeof(Object) == 16);
-    static_assert(sizeof(SlotObject) == 24);
+    static_assert(sizeof(Object) == sizeof(HeapObject) + 8);
+    static_assert(sizeof(SlotObject) == sizeof(HeapObject) + 16);
     static_assert(std::is_trivially_destructible_v<Object>);
     static_assert(std::is_trivially_destructible_v<SlotObject>);
 
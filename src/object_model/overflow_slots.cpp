@@ -19,6 +19,7 @@ namespace cl
         assert(slot_idx < capacity);
         Value old_value = slots[slot_idx];
         slots[slot_idx] = incref(value);
+        generational_write_barrier(this, value);
         decref(old_value);
     }
 
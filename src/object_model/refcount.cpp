@@ -1,5 +1,6 @@
 #include "object_model/refcount.h"
 #include "runtime/thread_state.h"
+#include "runtime/virtual_machine.h"
 
 namespace cl
 {
@@ -8,4 +9,19 @@ namespace cl
     {
         ThreadState::add_to_active_zero_count_table_if_needed(obj);
     }
+
+    void remember_old_object(HeapObject *owner)
+    {
+        ThreadState::get_active()->remember_old_object(owner);
+    }
+
+#if CL_REFCOUNT_MODE == CL_REFCOUNT_MODE_BIASED
+    constinit thread_local uint32_t active_refcount_owner = 0;
+
+    void queue_shared_refcount_merge(HeapObject *obj)
+    {
+        ThreadState::get_active()->get_machine()->queue_shared_refcount_merge(
+            obj);
+    }
+#endif
 }  // namespace cl
@@ -10,7 +10,7 @@ namespace cl
     static inline Value incref_refcounted_ptr(Value v)
     {
         assert(v.is_refcounted_ptr());
-        ++v.as.ptr->refcount;
+        heap_object_incref(v.as.ptr);
         return v;
     }
 
@@ -32,7 +32,7 @@ namespace cl
                heap_ptr_is_interned(obj));
         if(heap_ptr_is_refcounted(obj))
         {
-            ++obj->refcount;
+            heap_object_incref(obj);
         }
         return obj;
     }
@@ -41,7 +41,7 @@ namespace cl
     {
         if(v.is_refcounted_ptr())
         {
-            ++v.as.ptr->refcount;
+            heap_object_incref(v.as.ptr);
         }
         return v;
     }
@@ -58,7 +58,7 @@ namespace cl
     static inline void decref_refcounted_ptr(Value v)
     {
         assert(v.is_refcounted_ptr());
-        if(--v.as.ptr->refcount == 0)
+        if(heap_object_decref(v.as.ptr))
         {
             add_to_active_zero_count_table_if_needed(v.as.ptr);
         }
@@ -68,7 +68,7 @@ namespace cl
     {
         assert(obj == nullptr || heap_ptr_is_refcounted(obj) ||
                heap_ptr_is_interned(obj));
-        if(heap_ptr_is_refcounted(obj) && --obj->refcount == 0)
+        if(heap_ptr_is_refcounted(obj) && heap_object_decref(obj))
         {
             add_to_active_zero_count_table_if_needed(obj);
         }
@@ -78,7 +78,7 @@ namespace cl
     {
         if(v.is_refcounted_ptr())
         {
-            if(--v.as.ptr->refcount == 0)
+            if(heap_object_decref(v.as.ptr))
             {
                 add_to_active_zero_count_table_if_needed(v.as.ptr);
             }
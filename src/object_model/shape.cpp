@@ -5,9 +5,83 @@
 #include "runtime/fatal.h"
 #include "runtime/thread_state.h"
 #include "runtime/virtual_machine.h"
+#include <absl/container/flat_hash_map.h>
+#include <algorithm>
+#include <utility>
 
 namespace cl
 {
+    /*
+      Hash index from interned names to positions in a shape's descriptor or
+      transition array. Interned names compare by pointer, so the raw value
+      bits are the key. Names that are not interned cannot be keyed that way;
+      they are only counted, and lookups fall back to the string_eq scan while
+      any are present.
+    */
+    class ShapeNameIndex
+    {
+    public:
+        static bool is_indexable(TValue<String> name)
+        {
+            return name.raw_value().is_interned_ptr();
+        }
+
+        int32_t find(TValue<String> name, uint32_t qualifier) const
+        {
+            assert(is_indexable(name));
+            auto it = positions.find(key(name, qualifier));
+            return it == positions.end() ? -1 : int32_t(it->second);
+        }
+
+        void add(TValue<String> name, uint32_t qualifier, uint32_t position)
+        {
+            if(!is_indexable(name))
+            {
+                ++uninterned_count;
+                return;
+            }
+            positions[key(name, qualifier)] = position;
+        }
+
+        void remove(TValue<String> name, uint32_t qualifier)
+        {
+            if(!is_indexable(name))
+            {
+                assert(uninterned_count > 0);
+                --uninterned_count;
+                return;
+            }
+            positions.erase(key(name, qualifier));
+        }
+
+        void move(TValue<String> name, uint32_t qualifier, uint32_t position)
+        {
+            if(is_indexable(name))
+            {
+                positions[key(name, qualifier)] = position;
+            }
+        }
+
+        bool has_uninterned_names() const { return uninterned_count != 0; }
+
+    private:
+        using Key = std::pair<uint64_t, uint32_t>;
+
+        static Key key(TValue<String> name, uint32_t qualifier)
+        {
+            return Key{uint64_t(name.raw_value().as.integer), qualifier};
+        }
+
+        absl::flat_hash_map<Key, uint32_t> positions;
+        uint32_t uninterned_count = 0;
+    };
+
+    static uint32_t transition_qualifier(ShapeTransitionVerb verb,
+                                         DescriptorFlags descriptor_flags)
+    {
+        return uint32_t(verb) | (uint32_t(descriptor_flags) << 8);
+    }
+
     Shape::Transition::Transition(TValue<String> _name,
                                   ShapeTransitionVerb _verb,
                                   DescriptorFlags _descriptor_flags,
@@ -23,6 +97,8 @@ namespace cl
         Shape *shape = static_cast<Shape *>(obj);
 
         shape->transitions.clear();
+        shape->transition_index.reset();
+        shape->descriptor_index.reset();
 
         shape->class_value.release_ref();
         for(uint32_t idx = 0; idx < shape->property_count_; ++idx)
@@ -39,21 +115,39 @@ namespace cl
                  int32_t _next_slot_index, uint32_t _property_count,
                  uint32_t _inline_slot_capacity, ShapeFlags _shape_flags,
                  uint32_t _present_count)
+        : Shape(_class_value, _previous_shape, _next_slot_index,
+                _property_count, _inline_slot_capacity, _shape_flags,
+                _present_count, _property_count)
+    {
+    }
+
+    Shape::Shape(TValue<ClassObject> _class_value, Shape *_previous_shape,
+                 int32_t _next_slot_index, uint32_t _property_count,
+                 uint32_t _inline_slot_capacity, ShapeFlags _shape_flags,
+                 uint32_t _present_count, uint32_t _descriptor_capacity)
         : HeapObject(native_layout), previous_shape(_previous_shape),
           next_slot_index(_next_slot_index), property_count_(_property_count),
           present_count_(_present_count),
           inline_slot_capacity(_inline_slot_capacity),
-          shape_flags(_shape_flags), transitions(), class_value(_class_value)
+          descriptor_capacity_(_descriptor_capacity), shape_flags(_shape_flags),
+          delete_transition_count_(0), transitions(), descriptor_index(),
+          transition_index(), class_value(_class_value)
     {
+        // Class metadata bypasses the young generation, so Object::shape
+        // stores never need the generational write barrier.
+        generation = HeapGeneration::Old;
         assert(valid_shape_flags(shape_flags));
         assert(present_count_ <= property_count_);
-        for(uint32_t idx = 0; idx < property_count_; ++idx)
+        assert(property_count_ <= descriptor_capacity_);
+        for(uint32_t idx = 0; idx < descriptor_capacity_; ++idx)
         {
             descriptor_names[idx] = Value::None();
             descriptor_infos()[idx] = DescriptorInfo::not_found();
         }
     }
 
+    Shape::~Shape() = default;
+
     Shape *Shape::make_root_with_single_descriptor(
         TValue<ClassObject> class_value, TValue<String> name,
         DescriptorInfo info, int32_t next_slot_index,
@@ -123,52 +217,95 @@ namespace cl
         return inline_slot_capacity;
     }
 
-    int32_t Shape::lookup_descriptor_index(TValue<String> name) const
+    const ShapeNameIndex &Shape::ensure_descriptor_index() const
     {
-        for(uint32_t property_idx = 0; property_idx < present_count_;
-            ++property_idx)
+        if(descriptor_index == nullptr)
         {
-            if(string_eq(name, get_property_name(property_idx)))
+            descriptor_index = std::make_unique<ShapeNameIndex>();
+            for(uint32_t property_idx = 0; property_idx < property_count_;
+                ++property_idx)
             {
-                return property_idx;
+                descriptor_index->add(get_property_name(property_idx), 0,
+                                      property_idx);
             }
         }
-        return -1;
+        return *descriptor_index;
     }
 
-    DescriptorLookup Shape::lookup_present_descriptor(TValue<String> name) const
+    void Shape::index_descriptor(uint32_t property_idx)
     {
-        for(uint32_t property_idx = 0; property_idx < present_count_;
-            ++property_idx)
+        if(descriptor_index != nullptr)
+        {
+            descriptor_index->add(get_property_name(property_idx), 0,
+                                  property_idx);
+        }
+    }
+
+    void Shape::unindex_descriptor(uint32_t property_idx)
+    {
+        if(descriptor_index != nullptr)
+        {
+            descriptor_index->remove(get_property_name(property_idx), 0);
+        }
+    }
+
+    int32_t Shape::find_descriptor_index(TValue<String> name,
+                                         uint32_t end_idx) const
+    {
+        if(property_count_ >= indexed_lookup_threshold &&
+           ShapeNameIndex::is_indexable(name))
+        {
+            const ShapeNameIndex &index = ensure_descriptor_index();
+            int32_t property_idx = index.find(name, 0);
+            if(property_idx >= 0)
+            {
+                return uint32_t(property_idx) < end_idx ? property_idx : -1;
+            }
+            if(!index.has_uninterned_names())
+            {
+                return -1;
+            }
+        }
+
+        for(uint32_t property_idx = 0; property_idx < end_idx; ++property_idx)
         {
             if(string_eq(name, get_property_name(property_idx)))
             {
-                return DescriptorLookup{DescriptorPresence::Present,
-                                        int32_t(property_idx),
-                                        get_descriptor_info(property_idx)};
+                return property_idx;
             }
         }
+        return -1;
+    }
 
-        return DescriptorLookup::absent();
+    int32_t Shape::lookup_descriptor_index(TValue<String> name) const
+    {
+        return find_descriptor_index(name, present_count_);
+    }
+
+    DescriptorLookup Shape::lookup_present_descriptor(TValue<String> name) const
+    {
+        int32_t property_idx = find_descriptor_index(name, present_count_);
+        if(property_idx < 0)
+        {
+            return DescriptorLookup::absent();
+        }
+        return DescriptorLookup{DescriptorPresence::Present, property_idx,
+                                get_descriptor_info(property_idx)};
     }
 
     DescriptorLookup
     Shape::lookup_descriptor_including_latent(TValue<String> name) const
     {
-        for(uint32_t property_idx = 0; property_idx < property_count_;
-            ++property_idx)
+        int32_t property_idx = find_descriptor_index(name, property_count_);
+        if(property_idx < 0)
         {
-            if(string_eq(name, get_property_name(property_idx)))
-            {
-                DescriptorPresence presence = property_idx < present_count_
-                                                  ? DescriptorPresence::Present
-                                                  : DescriptorPresence::Latent;
-                return DescriptorLookup{presence, int32_t(property_idx),
-                                        get_descriptor_info(property_idx)};
-            }
+            return DescriptorLookup::absent();
         }
-
-        return DescriptorLookup::absent();
+        DescriptorPresence presence = uint32_t(property_idx) < present_count_
+                                          ? DescriptorPresence::Present
+                                          : DescriptorPresence::Latent;
+        return DescriptorLookup{presence, property_idx,
+                                get_descriptor_info(property_idx)};
     }
 
     StorageLocation Shape::resolve_present_property(TValue<String> name) const
@@ -191,6 +328,20 @@ namespace cl
                                     ShapeTransitionVerb verb,
                                     DescriptorFlags descriptor_flags) const
     {
+        if(transition_index != nullptr && ShapeNameIndex::is_indexable(name))
+        {
+            int32_t transition_idx = transition_index->find(
+                name, transition_qualifier(verb, descriptor_flags));
+            if(transition_idx >= 0)
+            {
+                return transitions[transition_idx].get_next_shape();
+            }
+            if(!transition_index->has_uninterned_names())
+            {
+                return nullptr;
+            }
+        }
+
         for(const Transition &transition: transitions)
         {
             if(transition.get_verb() == verb &&
@@ -207,6 +358,7 @@ namespace cl
                                     ShapeTransitionVerb verb,
                                     DescriptorFlags descriptor_flags)
     {
+        assert(!is_dictionary_mode());
         if(Shape *existing = lookup_transition(name, verb, descriptor_flags))
         {
             return existing;
@@ -224,9 +376,39 @@ namespace cl
         }
 
         transitions.emplace_back(name, verb, descriptor_flags, next_shape);
+        if(transition_index != nullptr)
+        {
+            transition_index->add(name,
+                                  transition_qualifier(verb, descriptor_flags),
+                                  transitions.size() - 1);
+        }
+        else if(transitions.size() >= indexed_lookup_threshold)
+        {
+            transition_index = std::make_unique<ShapeNameIndex>();
+            for(uint32_t transition_idx = 0;
+                transition_idx < transitions.size(); ++transition_idx)
+            {
+                const Transition &transition = transitions[transition_idx];
+                transition_index->add(
+                    transition.get_name(),
+                    transition_qualifier(transition.get_verb(),
+                                         transition.get_descriptor_flags()),
+                    transition_idx);
+            }
+        }
         return next_shape;
     }
 
+    StorageLocation Shape::storage_location_for_slot(int32_t slot_index) const
+    {
+        if(uint32_t(slot_index) < get_inline_slot_count())
+        {
+            return StorageLocation{slot_index, StorageKind::Inline};
+        }
+        return StorageLocation{slot_index - int32_t(get_inline_slot_count()),
+                               StorageKind::Overflow};
+    }
+
     Shape *Shape::derive_add_transition(TValue<String> name,
                                         DescriptorFlags descriptor_flags)
     {
@@ -245,20 +427,8 @@ namespace cl
         }
         else
         {
-            StorageLocation storage_location;
-            if(uint32_t(next_slot_index) < get_inline_slot_count())
-            {
-                storage_location =
-                    StorageLocation{next_slot_index, StorageKind::Inline};
-            }
-            else
-            {
-                storage_location = StorageLocation{
-                    next_slot_index - int32_t(get_inline_slot_count()),
-                    StorageKind::Overflow};
-            }
-            inserted_info =
-                DescriptorInfo::make(storage_location, descriptor_flags);
+            inserted_info = DescriptorInfo::make(
+                storage_location_for_slot(next_slot_index), descriptor_flags);
             next_slot_index_for_shape = next_slot_index + 1;
             next_property_count = property_count_ + 1;
         }
@@ -266,6 +436,7 @@ namespace cl
         Shape *next_shape = make_internal_raw<Shape>(
             class_value, this, next_slot_index_for_shape, next_property_count,
             inline_slot_capacity, shape_flags, present_count_ + 1);
+        next_shape->delete_transition_count_ = delete_transition_count_;
         uint32_t next_property_idx = 0;
         for(uint32_t property_idx = 0; property_idx < present_count_;
             ++property_idx)
@@ -311,6 +482,8 @@ namespace cl
         Shape *next_shape = make_internal_raw<Shape>(
             class_value, this, next_slot_index, next_property_count,
             inline_slot_capacity, shape_flags, present_count_ - 1);
+        next_shape->delete_transition_count_ = uint16_t(std::min<uint32_t>(
+            uint32_t(delete_transition_count_) + 1, UINT16_MAX));
         uint32_t next_property_idx = 0;
         for(uint32_t property_idx = 0; property_idx < present_count_;
             ++property_idx)
@@ -346,20 +519,27 @@ namespace cl
         return next_shape;
     }
 
+    void Shape::copy_descriptors_from(const Shape *source)
+    {
+        assert(property_count_ == source->property_count_);
+        for(uint32_t property_idx = 0; property_idx < property_count_;
+            ++property_idx)
+        {
+            descriptor_names[property_idx] =
+                incref(source->get_property_name(property_idx).raw_value());
+            descriptor_infos()[property_idx] =
+                source->get_descriptor_info(property_idx);
+        }
+        delete_transition_count_ = source->delete_transition_count_;
+    }
+
     Shape *Shape::clone_with_flags(ShapeFlags new_shape_flags) const
     {
         assert(valid_shape_flags(new_shape_flags));
         Shape *cloned_shape = make_internal_raw<Shape>(
             class_value, previous_shape, next_slot_index, property_count_,
             inline_slot_capacity, new_shape_flags, present_count_);
-        for(uint32_t property_idx = 0; property_idx < property_count_;
-            ++property_idx)
-        {
-            cloned_shape->descriptor_names[property_idx] =
-                incref(get_property_name(property_idx).raw_value());
-            cloned_shape->descriptor_infos()[property_idx] =
-                get_descriptor_info(property_idx);
-        }
+        cloned_shape->copy_descriptors_from(this);
         return cloned_shape;
     }
 
@@ -369,15 +549,150 @@ namespace cl
         Shape *cloned_shape = make_internal_raw<Shape>(
             new_class, previous_shape, next_slot_index, property_count_,
             inline_slot_capacity, shape_flags, present_count_);
-        for(uint32_t property_idx = 0; property_idx < property_count_;
-            ++property_idx)
+        cloned_shape->copy_descriptors_from(this);
+        return cloned_shape;
+    }
+
+    bool Shape::exceeds_fast_mode_budget(TValue<String> name,
+                                         ShapeTransitionVerb verb,
+                                         DescriptorFlags descriptor_flags) const
+    {
+        if(is_dictionary_mode())
         {
-            cloned_shape->descriptor_names[property_idx] =
-                incref(get_property_name(property_idx).raw_value());
-            cloned_shape->descriptor_infos()[property_idx] =
-                get_descriptor_info(property_idx);
+            return true;
         }
-        return cloned_shape;
+        // Following a transition that already exists mints nothing.
+        if(lookup_transition(name, verb, descriptor_flags) != nullptr)
+        {
+            return false;
+        }
+        if(transitions.size() >= max_fast_transition_count)
+        {
+            return true;
+        }
+        switch(verb)
+        {
+            case ShapeTransitionVerb::Add:
+                return present_count_ >= max_fast_property_count;
+            case ShapeTransitionVerb::Delete:
+                return delete_transition_count_ >=
+                       max_fast_delete_transition_count;
+        }
+        __builtin_unreachable();
+    }
+
+    Shape *Shape::make_dictionary_mode_copy() const
+    {
+        // Leave room for the add that usually triggers the conversion, so the
+        // copy is edited in place rather than immediately outgrown.
+        return make_dictionary_mode_copy(
+            std::max(property_count_ * 2, property_count_ + 4));
+    }
+
+    Shape *Shape::make_dictionary_mode_copy(uint32_t descriptor_capacity) const
+    {
+        assert(descriptor_capacity > property_count_);
+        Shape *copy = make_internal_raw<Shape>(
+            class_value, nullptr, next_slot_index, property_count_,
+            inline_slot_capacity,
+            shape_flags | shape_flag(ShapeFlag::IsDictionaryMode),
+            present_count_, descriptor_capacity);
+        copy->copy_descriptors_from(this);
+        return copy;
+    }
+
+    void Shape::swap_descriptors(uint32_t left_idx, uint32_t right_idx)
+    {
+        if(left_idx == right_idx)
+        {
+            return;
+        }
+        std::swap(descriptor_names[left_idx], descriptor_names[right_idx]);
+        std::swap(descriptor_infos()[left_idx], descriptor_infos()[right_idx]);
+        if(descriptor_index != nullptr)
+        {
+            descriptor_index->move(get_property_name(left_idx), 0, left_idx);
+            descriptor_index->move(get_property_name(right_idx), 0, right_idx);
+        }
+    }
+
+    Shape *Shape::add_dictionary_property(TValue<String> name,
+                                          DescriptorFlags descriptor_flags)
+    {
+        assert(is_dictionary_mode());
+        assert(lookup_descriptor_index(name) < 0);
+
+        // Deleted properties stay behind as latent descriptors that still own
+        // their storage slot. Re-adding the same name takes its old slot back;
+        // any other name recycles the most recently freed one, so add/delete
+        // churn never grows the object's storage.
+        int32_t latent_idx = find_descriptor_index(name, property_count_);
+        if(latent_idx < 0 && latent_count() > 0)
+        {
+            latent_idx = int32_t(property_count_ - 1);
+        }
+        if(latent_idx >= 0)
+        {
+            uint32_t property_idx = present_count_;
+            swap_descriptors(property_idx, uint32_t(latent_idx));
+            if(!string_eq(name, get_property_name(property_idx)))
+            {
+                unindex_descriptor(property_idx);
+                Value old_name = descriptor_names[property_idx];
+                descriptor_names[property_idx] = incref(name.raw_value());
+                decref(old_name);
+                index_descriptor(property_idx);
+            }
+            StorageLocation location =
+                get_property_storage_location(property_idx);
+            assert(location.is_found());
+            descriptor_infos()[property_idx] =
+                DescriptorInfo::make(location, descriptor_flags);
+            ++present_count_;
+            return this;
+        }
+
+        if(property_count_ == descriptor_capacity_)
+        {
+            return make_dictionary_mode_copy(descriptor_capacity_ * 2)
+                ->add_dictionary_property(name, descriptor_flags);
+        }
+
+        uint32_t property_idx = property_count_;
+        descriptor_names[property_idx] = incref(name.raw_value());
+        descriptor_infos()[property_idx] = DescriptorInfo::make(
+            storage_location_for_slot(next_slot_index), descriptor_flags);
+        ++next_slot_index;
+        ++property_count_;
+        ++present_count_;
+        index_descriptor(property_idx);
+        return this;
+    }
+
+    void Shape::delete_dictionary_property(StorageLocation location)
+    {
+        assert(is_dictionary_mode());
+        uint32_t property_idx = 0;
+        while(property_idx < present_count_)
+        {
+            StorageLocation candidate =
+                get_property_storage_location(property_idx);
+            if(candidate.physical_idx == location.physical_idx &&
+               candidate.kind == location.kind)
+            {
+                break;
+            }
+            ++property_idx;
+        }
+        assert(property_idx < present_count_);
+
+        // Keep the remaining properties in insertion order; the deleted one
+        // becomes the first latent descriptor.
+        for(; property_idx + 1 < present_count_; ++property_idx)
+        {
+            swap_descriptors(property_idx, property_idx + 1);
+        }
+        --present_count_;
     }
 
 }  // namespace cl
@@ -9,11 +9,13 @@
 #include "object_model/value.h"
 #include <cstddef>
 #include <cstdint>
+#include <memory>
 #include <vector>
 
 namespace cl
 {
     class ClassObject;
+    class ShapeNameIndex;
     class VirtualMachine;
     enum class ShapeTransitionVerb : uint8_t
     {
@@ -33,6 +35,7 @@ namespace cl
         DisallowAttributeUpdates = 1 << 6,
         DisallowAttributeAddDelete = 1 << 7,
         IsModuleObject = 1 << 8,
+        IsDictionaryMode = 1 << 9,
     };
 
     using ShapeFlags = uint16_t;
@@ -107,10 +110,27 @@ namespace cl
             OwnedHeapPtr<Shape> next_shape;
         };
 
+        // Shapes with at least this many descriptors or transitions build a
+        // hash index over their interned names on first lookup.
+        static constexpr uint32_t indexed_lookup_threshold = 16;
+
+        // Budgets past which an instance leaves the shared transition tree
+        // for a private dictionary-mode shape instead of deriving another
+        // shape: present properties, outgoing transitions of one shape, and
+        // delete transitions taken since the root.
+        static constexpr uint32_t max_fast_property_count = 128;
+        static constexpr uint32_t max_fast_transition_count = 64;
+        static constexpr uint32_t max_fast_delete_transition_count = 8;
+
         Shape(TValue<ClassObject> class_value, Shape *previous_shape,
               int32_t next_slot_index, uint32_t property_count,
               uint32_t inline_slot_capacity, ShapeFlags shape_flags,
               uint32_t present_count);
+        Shape(TValue<ClassObject> class_value, Shape *previous_shape,
+              int32_t next_slot_index, uint32_t property_count,
+              uint32_t inline_slot_capacity, ShapeFlags shape_flags,
+              uint32_t present_count, uint32_t descriptor_capacity);
+        ~Shape();
 
         static Shape *make_root_with_single_descriptor(
             TValue<ClassObject> class_value, TValue<String> name,
@@ -131,10 +151,10 @@ namespace cl
             int32_t next_slot_index, uint32_t present_count,
             uint32_t inline_slot_capacity, ShapeFlags shape_flags);
 
-        static size_t size_for(uint32_t property_count)
+        static size_t size_for(uint32_t descriptor_capacity)
         {
-            return sizeof(Shape) + sizeof(Value) * property_count -
-                   sizeof(Value) + sizeof(DescriptorInfo) * property_count;
+            return sizeof(Shape) + sizeof(Value) * descriptor_capacity -
+                   sizeof(Value) + sizeof(DescriptorInfo) * descriptor_capacity;
         }
         static size_t size_for(TValue<ClassObject> class_value,
                                Shape *previous_shape, int32_t next_slot_index,
@@ -150,9 +170,25 @@ namespace cl
             (void)present_count;
             return size_for(property_count);
         }
+        static size_t size_for(TValue<ClassObject> class_value,
+                               Shape *previous_shape, int32_t next_slot_index,
+                               uint32_t property_count,
+                               uint32_t inline_slot_capacity,
+                               ShapeFlags shape_flags, uint32_t present_count,
+                               uint32_t descriptor_capacity)
+        {
+            (void)class_value;
+            (void)previous_shape;
+            (void)next_slot_index;
+            (void)property_count;
+            (void)inline_slot_capacity;
+            (void)shape_flags;
+            (void)present_count;
+            return size_for(descriptor_capacity);
+        }
         static size_t object_size_in_bytes(const Shape *shape)
         {
-            return size_for(shape->property_count());
+            return size_for(shape->descriptor_capacity_);
         }
 
         ClassObject *get_class() const
@@ -190,6 +226,13 @@ namespace cl
         {
             return !has_flag(ShapeFlag::DisallowAttributeAddDelete);
         }
+        // A dictionary-mode shape belongs to a single instance and is edited
+        // in place by add/delete instead of deriving transitions, so inline
+        // caches must never key on it.
+        bool is_dictionary_mode() const
+        {
+            return has_flag(ShapeFlag::IsDictionaryMode);
+        }
         TValue<String> get_property_name(uint32_t property_idx) const
         {
             assert(property_idx < property_count_);
@@ -226,21 +269,41 @@ namespace cl
         Shape *clone_with_flags(ShapeFlags new_shape_flags) const;
         Shape *clone_with_class(TValue<ClassObject> new_class) const;
 
+        bool exceeds_fast_mode_budget(
+            TValue<String> name, ShapeTransitionVerb verb,
+            DescriptorFlags descriptor_flags =
+                descriptor_flag(DescriptorFlag::None)) const;
+        Shape *make_dictionary_mode_copy() const;
+        // Both return the shape the instance should hold afterwards: this
+        // shape, or a larger copy when the descriptor arrays were full.
+        Shape *add_dictionary_property(TValue<String> name,
+                                       DescriptorFlags descriptor_flags);
+        void delete_dictionary_property(StorageLocation location);
+
     private:
         void initialize_root_descriptors(const ShapeRootDescriptor *descriptors,
                                          uint32_t descriptor_count);
+        Shape *make_dictionary_mode_copy(uint32_t descriptor_capacity) const;
+        void copy_descriptors_from(const Shape *source);
+        StorageLocation storage_location_for_slot(int32_t slot_index) const;
+        int32_t find_descriptor_index(TValue<String> name,
+                                      uint32_t end_idx) const;
+        const ShapeNameIndex &ensure_descriptor_index() const;
+        void index_descriptor(uint32_t property_idx);
+        void unindex_descriptor(uint32_t property_idx);
+        void swap_descriptors(uint32_t left_idx, uint32_t right_idx);
         Shape *derive_add_transition(TValue<String> name,
                                      DescriptorFlags descriptor_flags);
         Shape *derive_delete_transition(TValue<String> name);
         DescriptorInfo *descriptor_infos()
         {
             return reinterpret_cast<DescriptorInfo *>(
-                &descriptor_names[property_count_]);
+                &descriptor_names[descriptor_capacity_]);
         }
         const DescriptorInfo *descriptor_infos() const
         {
             return reinterpret_cast<const DescriptorInfo *>(
-                &descriptor_names[property_count_]);
+                &descriptor_names[descriptor_capacity_]);
         }
 
         Shape *previous_shape;
@@ -248,8 +311,12 @@ namespace cl
         uint32_t property_count_;
         uint32_t present_count_;
         uint32_t inline_slot_capacity;
+        uint32_t descriptor_capacity_;
         ShapeFlags shape_flags;
+        uint16_t delete_transition_count_;
         std::vector<Transition> transitions;
+        mutable std::unique_ptr<ShapeNameIndex> descriptor_index;
+        std::unique_ptr<ShapeNameIndex> transition_index;
         Member<TValue<ClassObject>> class_value;
         Value descriptor_names[1];
 
@@ -1,9 +1,11 @@
 #ifndef CL_VALUE_H
 #define CL_VALUE_H
 
+#include "build_config.h"
 #include "object_model/object.h"
 #include "util/compiler.h"
 #include <assert.h>
+#include <bit>
 #include <stdbool.h>
 #include <stdint.h>
 #include <type_traits>
@@ -11,6 +13,7 @@
 namespace cl
 {
     void add_to_active_zero_count_table_if_needed(HeapObject *obj);
+    void remember_old_object(HeapObject *owner);
 
     /*
       A Value is a 64-bit generic cell to hold any value. It holds some
@@ -41,8 +44,17 @@ namespace cl
           0x24: True
           0x25: NotImplemented
           0x26: Ellipsis
+          0x07: immediate float (CLOVERVM_FLOAT_ENCODING=immediate only)
           0x08: interned pointer
           0x10: refcounted pointer
+
+      An immediate float keeps the sign, the full 52-bit mantissa and 6 of
+      the 11 exponent bits of a double, in the same style as Spur's
+      SmallFloat64. The double is rotated left by one so the sign sits in
+      bit 0, then the exponent is rebased so biased exponents 992..1054
+      (magnitudes from 2^-31 up to 2^32) land in 1..63. +0.0 is payload 0,
+      which keeps the truthiness mask valid. -0.0, NaN, infinities and
+      values outside that range stay boxed `Float` objects.
     */
     static constexpr uint64_t value_tag_bits = 5;
     static constexpr uint64_t value_tag_mask = 0x1f;
@@ -56,6 +68,10 @@ namespace cl
     static constexpr uint64_t value_exception = 0x03;
     static constexpr uint64_t value_not_implemented = 0x25;
     static constexpr uint64_t value_ellipsis = 0x26;
+    static constexpr uint64_t value_immediate_float_tag = 0x07;
+    static constexpr bool value_immediate_floats =
+        CL_FLOAT_ENCODING == CL_FLOAT_ENCODING_IMMEDIATE;
+    static constexpr uint64_t value_immediate_float_exponent_base = 991;
     static constexpr uint64_t value_truthy_mask = 0xffffffffffffffe0ull;
     static constexpr uint64_t value_ptr_mask =
         value_refcounted_ptr_tag | value_interned_ptr_tag;
@@ -117,6 +133,33 @@ namespace cl
             return val;
         }
 
+        // Encodes `v` as an immediate float. Returns false in boxed-float
+        // builds and for doubles outside the immediate range.
+        static inline bool try_from_immediate_float(double v, Value *out)
+        {
+            if constexpr(!value_immediate_floats)
+            {
+                (void)v;
+                (void)out;
+                return false;
+            }
+            uint64_t bits = std::bit_cast<uint64_t>(v);
+            if(bits == 0)
+            {
+                out->as.integer = value_immediate_float_tag;
+                return true;
+            }
+            uint64_t payload = std::rotl(bits, 1) -
+                               (value_immediate_float_exponent_base << 53);
+            if(payload - (uint64_t(1) << 53) >= (uint64_t(63) << 53))
+            {
+                return false;
+            }
+            out->as.integer = int64_t((payload << value_tag_bits) |
+                                      value_immediate_float_tag);
+            return true;
+        }
+
         static inline Value None()
         {
             Value val;
@@ -222,6 +265,32 @@ namespace cl
             return as.integer == value_ellipsis;
         }
 
+        bool is_immediate_float() const
+        {
+            return value_immediate_floats &&
+                   (as.integer & value_tag_mask) == value_immediate_float_tag;
+        }
+
+        double get_immediate_float() const
+        {
+            assert(is_immediate_float());
+            uint64_t payload = uint64_t(as.integer) >> value_tag_bits;
+            if(payload == 0)
+            {
+                return 0.0;
+            }
+            return std::bit_cast<double>(std::rotr(
+                payload + (value_immediate_float_exponent_base << 53), 1));
+        }
+
+        // Whether two inline values are equal exactly when their bits match
+        // after clearing the boolean tag. Immediate floats compare by value
+        // against ints, so they take the dispatching path.
+        bool has_bitwise_equality() const
+        {
+            return !is_ptr() && !is_immediate_float();
+        }
+
         ValueStorageClass storage_class() const
         {
             switch(as.integer & value_ptr_mask)
@@ -326,6 +395,31 @@ namespace cl
         return static_cast<T *>(value.get_ptr<Object>());
     }
 
+    /*
+      Generational write barrier. Heap stores call it after writing `value`
+      into a slot physically held by `owner`. An Old owner that now
+      references a Young object is recorded in the active thread's
+      remembered set. Refcounting still decides lifetime; the barrier only
+      keeps the old-to-young edge set exact.
+    */
+    ALWAYSINLINE void generational_write_barrier_refcounted(HeapObject *owner,
+                                                            HeapObject *child)
+    {
+        if(owner->generation == HeapGeneration::Old &&
+           child->generation == HeapGeneration::Young)
+        {
+            remember_old_object(owner);
+        }
+    }
+
+    ALWAYSINLINE void generational_write_barrier(HeapObject *owner, Value value)
+    {
+        if(value.is_refcounted_ptr())
+        {
+            generational_write_barrier_refcounted(owner, value.as.ptr);
+        }
+    }
+
 }  // namespace cl
 
 #ifndef CL_OVERFLOW_SLOTS_H
@@ -356,6 +450,7 @@ namespace cl
         StorageLocation location, Value value)
     {
         Value *slots = nullptr;
+        HeapObject *holder = this;
         switch(location.kind)
         {
             case StorageKind::Inline:
@@ -368,6 +463,7 @@ namespace cl
                     assert(uint32_t(location.physical_idx) <
                            overflow_slots->get_size());
                     slots = overflow_slots->slot_value_base();
+                    holder = overflow_slots;
                     break;
                 }
         }
@@ -375,10 +471,11 @@ namespace cl
         Value old_value = slots[location.physical_idx];
         if(value.is_refcounted_ptr())
         {
-            ++value.as.ptr->refcount;
+            heap_object_incref(value.as.ptr);
         }
         slots[location.physical_idx] = value;
-        if(old_value.is_refcounted_ptr() && --old_value.as.ptr->refcount == 0)
+        generational_write_barrier(holder, value);
+        if(old_value.is_refcounted_ptr() && heap_object_decref(old_value.as.ptr))
         {
             return old_value.as.ptr;
         }
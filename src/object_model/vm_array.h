@@ -360,7 +360,7 @@ namespace cl
             }
 
             *slot = incref(value);
-            if(old.is_refcounted_ptr() && --old.as.ptr->refcount == 0)
+            if(old.is_refcounted_ptr() && heap_object_decref(old.as.ptr))
             {
                 return old.as.ptr;
             }
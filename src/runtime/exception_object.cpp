@@ -59,6 +59,12 @@ namespace cl
             NativeLayoutId::Exception};
         ClassObject *cls =
             make_exception_class_raw(vm, L"BaseException", vm->object_class());
+        // Exceptions that have never been observed in flight report no
+        // traceback; raised ones get an own __traceback__ when bound.
+        [[maybe_unused]] bool installed = cls->set_own_property(
+            vm->get_or_create_interned_string_value(L"__traceback__"),
+            Value::None());
+        assert(installed);
         return builtin_class_definition(cls, native_layout_ids,
                                         BuiltinsVisibility::Public);
     }
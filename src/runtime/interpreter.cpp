@@ -33,6 +33,7 @@
 #include "runtime/runtime_helpers.h"
 #include "runtime/thread_state.h"
 #include "runtime/virtual_machine.h"
+#include <algorithm>
 #include <bit>
 #include <cmath>
 #include <cstdint>
@@ -438,6 +439,18 @@ namespace cl
         COMPLETE();
     }
 
+    NOINLINE INTERP_CC Value unpack_args_type_error(PARAMS)
+    {
+        ExceptionalTarget target = set_builtin_exception_and_resolve_frame_exit(
+            thread, fp, pc, code_object, L"TypeError",
+            L"argument after * must be a list or tuple");
+        fp = target.fp;
+        code_object = target.code_object;
+        pc = target.interpreted_pc;
+        START(0);
+        COMPLETE();
+    }
+
     static constexpr size_t kObjectCacheLineBytes = 128;
     static constexpr size_t kObjectCacheLineStartOffset = 16;
     static constexpr uint32_t kMaxFactoryInlineSlotCount =
@@ -514,13 +527,16 @@ namespace cl
         COMPLETE();
     }
 
-    [[maybe_unused]] static NOINLINE ExceptionalTarget
-    resolve_exceptional_frame_exit(ThreadState *thread, Value *fp,
-                                   const uint8_t *pc, CodeObject *code_object)
+    static ExceptionalTarget
+    resolve_exceptional_frame_exit_from(ThreadState *thread, Value *fp,
+                                        const uint8_t *pc,
+                                        CodeObject *code_object,
+                                        bool record_raise_frame)
     {
         assert(thread->has_pending_exception());
 
         const uint8_t *continuation_pc = pc + 1;
+        bool record_frame = record_raise_frame;
         for(;;)
         {
             // Exception tables cover the bytecode instruction that raised or
@@ -534,6 +550,12 @@ namespace cl
             uint32_t continuation_offset =
                 code_object->offset_for_interpreted_pc(continuation_pc);
             assert(continuation_offset > 0);
+            if(record_frame && !code_object->hide_from_traceback)
+            {
+                thread->record_pending_traceback_entry(
+                    code_object, continuation_offset - 1);
+            }
+            record_frame = true;
             const ExceptionTableEntry *entry =
                 code_object->find_exception_handler(continuation_offset - 1);
             if(entry != nullptr)
@@ -548,6 +570,24 @@ namespace cl
         }
     }
 
+    [[maybe_unused]] static NOINLINE ExceptionalTarget
+    resolve_exceptional_frame_exit(ThreadState *thread, Value *fp,
+                                   const uint8_t *pc, CodeObject *code_object)
+    {
+        return resolve_exceptional_frame_exit_from(thread, fp, pc, code_object,
+                                                   true);
+    }
+
+    // Re-raising the active exception from its handler frame continues the
+    // traceback that already records this frame.
+    static NOINLINE ExceptionalTarget
+    resolve_reraised_frame_exit(ThreadState *thread, Value *fp,
+                                const uint8_t *pc, CodeObject *code_object)
+    {
+        return resolve_exceptional_frame_exit_from(thread, fp, pc, code_object,
+                                                   false);
+    }
+
     static void initialize_class_body_frame(Value *fp, CodeObject *body_code)
     {
         Scope *local_scope = body_code->get_local_scope_ptr();
@@ -708,15 +748,10 @@ namespace cl
         COMPLETE();
     }
 
-    NOINLINE static void materialize_pending_stop_iteration(ThreadState *thread)
+    NOINLINE static TValue<Exception>
+    observe_pending_exception_object(ThreadState *thread)
     {
-        Value value = thread->pending_stop_iteration_value();
-        ClassObject *stop_iteration =
-            thread->class_for_native_layout(NativeLayoutId::StopIteration);
-        TValue<StopIterationObject> exception = make_stop_iteration_object(
-            thread, TValue<ClassObject>::from_oop(stop_iteration), value);
-        (void)thread->set_pending_exception_object(
-            TValue<Exception>::from_value_unchecked(exception.raw_value()));
+        return thread->observe_pending_exception_object();
     }
 
     static INTERP_CC Value op_lda_active_exception(PARAMS)
@@ -725,18 +760,8 @@ namespace cl
         {
             MUSTTAIL return active_exception_required_system_error(ARGS);
         }
-        if(thread->pending_exception_kind() ==
-           PendingExceptionKind::StopIteration)
-        {
-            materialize_pending_stop_iteration(thread);
-        }
-        else if(thread->pending_exception_kind() !=
-                PendingExceptionKind::Object)
-        {
-            MUSTTAIL return active_exception_required_system_error(ARGS);
-        }
 
-        accumulator = thread->pending_exception_object().raw_value();
+        accumulator = observe_pending_exception_object(thread).raw_value();
         START(1);
         COMPLETE();
     }
@@ -766,6 +791,9 @@ namespace cl
                 exception_class = thread->class_for_native_layout(
                     NativeLayoutId::StopIteration);
                 break;
+            case PendingExceptionKind::Class:
+                exception_class = thread->pending_exception_class();
+                break;
             case PendingExceptionKind::None:
                 MUSTTAIL return active_exception_required_system_error(ARGS);
         }
@@ -784,20 +812,11 @@ namespace cl
         {
             MUSTTAIL return active_exception_required_system_error(ARGS);
         }
-        if(thread->pending_exception_kind() ==
-           PendingExceptionKind::StopIteration)
-        {
-            materialize_pending_stop_iteration(thread);
-        }
-        else if(thread->pending_exception_kind() !=
-                PendingExceptionKind::Object)
-        {
-            MUSTTAIL return active_exception_required_system_error(ARGS);
-        }
 
+        TValue<Exception> exception = observe_pending_exception_object(thread);
         START(2);
         int8_t reg = pc[1];
-        fp[reg] = thread->pending_exception_object().raw_value();
+        fp[reg] = exception.raw_value();
         thread->clear_pending_exception();
         COMPLETE();
     }
@@ -817,7 +836,7 @@ namespace cl
         }
 
         ExceptionalTarget target =
-            resolve_exceptional_frame_exit(thread, fp, pc, code_object);
+            resolve_reraised_frame_exit(thread, fp, pc, code_object);
         fp = target.fp;
         code_object = target.code_object;
         pc = target.interpreted_pc;
@@ -875,10 +894,35 @@ namespace cl
         assert(ok);
     }
 
-    NOINLINE INTERP_CC Value raise_unwind(PARAMS)
+    // `raise SomeClass` leaves the instance unallocated until a handler binds
+    // it or it crosses back into native code; handlers that only match on the
+    // class and clear the exception never build it.
+    static void set_pending_raised_exception(ThreadState *thread, Value raised)
     {
+        if(can_convert_to<ClassObject>(raised))
+        {
+            ClassObject *cls = raised.get_ptr<ClassObject>();
+            if(cls ==
+               thread->class_for_native_layout(NativeLayoutId::StopIteration))
+            {
+                (void)thread->set_pending_stop_iteration_no_value();
+                return;
+            }
+            if(is_subclass_of(cls, thread->class_for_native_layout(
+                                       NativeLayoutId::Exception)))
+            {
+                (void)thread->set_pending_exception_class(
+                    TValue<ClassObject>::from_oop(cls));
+                return;
+            }
+        }
         (void)thread->set_pending_exception_object(
-            make_raise_exception_object(thread, accumulator));
+            make_raise_exception_object(thread, raised));
+    }
+
+    NOINLINE INTERP_CC Value raise_unwind(PARAMS)
+    {
+        set_pending_raised_exception(thread, accumulator);
 
         ExceptionalTarget target =
             resolve_exceptional_frame_exit(thread, fp, pc, code_object);
@@ -920,6 +964,22 @@ namespace cl
         COMPLETE();
     }
 
+    // Re-raises an exception a handler or cleanup block drained earlier in
+    // this frame. The frame is already in the exception's traceback, so
+    // unwinding does not record it again.
+    NOINLINE INTERP_CC Value reraise_unwind(PARAMS)
+    {
+        set_pending_raised_exception(thread, accumulator);
+
+        ExceptionalTarget target =
+            resolve_reraised_frame_exit(thread, fp, pc, code_object);
+        fp = target.fp;
+        code_object = target.code_object;
+        pc = target.interpreted_pc;
+        START(0);
+        COMPLETE();
+    }
+
     NOINLINE static INTERP_CC Value overflow_path(PARAMS)
     {
         MUSTTAIL return raise_overflow_error(ARGS);
@@ -928,12 +988,12 @@ namespace cl
     NOINLINE static INTERP_CC Value op_not_float_truthiness(PARAMS)
     {
         START(1);
-        if(!can_convert_to<Float>(accumulator))
+        if(!is_float_value(accumulator))
         {
             MUSTTAIL return unsupported_truthiness_error(ARGS);
         }
 
-        accumulator = accumulator.get_ptr<Float>()->value() != 0.0
+        accumulator = float_value(accumulator) != 0.0
                           ? Value::False()
                           : Value::True();
         COMPLETE();
@@ -942,12 +1002,12 @@ namespace cl
     NOINLINE static INTERP_CC Value op_to_bool_float_truthiness(PARAMS)
     {
         START(1);
-        if(!can_convert_to<Float>(accumulator))
+        if(!is_float_value(accumulator))
         {
             MUSTTAIL return unsupported_truthiness_error(ARGS);
         }
 
-        accumulator = accumulator.get_ptr<Float>()->value() != 0.0
+        accumulator = float_value(accumulator) != 0.0
                           ? Value::True()
                           : Value::False();
         COMPLETE();
@@ -956,12 +1016,12 @@ namespace cl
     NOINLINE static INTERP_CC Value op_to_bool_not_float_truthiness(PARAMS)
     {
         START(1);
-        if(!can_convert_to<Float>(accumulator))
+        if(!is_float_value(accumulator))
         {
             MUSTTAIL return unsupported_truthiness_error(ARGS);
         }
 
-        accumulator = accumulator.get_ptr<Float>()->value() != 0.0
+        accumulator = float_value(accumulator) != 0.0
                           ? Value::False()
                           : Value::True();
         COMPLETE();
@@ -970,15 +1030,19 @@ namespace cl
     NOINLINE static INTERP_CC Value op_jump_if_true_float_truthiness(PARAMS)
     {
         int16_t rel_target = read_int16_le(&pc[1]);
-        if(!can_convert_to<Float>(accumulator))
+        if(!is_float_value(accumulator))
         {
             MUSTTAIL return unsupported_truthiness_error(ARGS);
         }
 
         pc += 3;
-        if(accumulator.get_ptr<Float>()->value() != 0.0)
+        if(float_value(accumulator) != 0.0)
         {
             pc += rel_target;
+            if(rel_target < 0 && unlikely(thread->safepoint_requested()))
+            {
+                MUSTTAIL return op_committed_safepoint_slow(ARGS);
+            }
         }
 
         START(0);
@@ -988,13 +1052,13 @@ namespace cl
     NOINLINE static INTERP_CC Value op_jump_if_false_float_truthiness(PARAMS)
     {
         int16_t rel_target = read_int16_le(&pc[1]);
-        if(!can_convert_to<Float>(accumulator))
+        if(!is_float_value(accumulator))
         {
             MUSTTAIL return unsupported_truthiness_error(ARGS);
         }
 
         pc += 3;
-        if(accumulator.get_ptr<Float>()->value() == 0.0)
+        if(float_value(accumulator) == 0.0)
         {
             pc += rel_target;
         }
@@ -1300,6 +1364,84 @@ namespace cl
         return Expected<void>::ok();
     }
 
+    // Records a specialization offered by the callee's code object. The
+    // arguments are still in the caller's registers, so the resolver sees the
+    // shapes of exactly the values the specialized target will receive.
+    NOINLINE static void
+    populate_function_call_specialization(ThreadState *thread,
+                                          FunctionCallInlineCache &cache,
+                                          const Value *first_arg,
+                                          uint32_t n_args)
+    {
+        CodeObject *target_code_object = cache.code_object;
+        if(target_code_object->specialization_resolver == nullptr ||
+           n_args == 0 || n_args > 3)
+        {
+            return;
+        }
+
+        uint32_t n_guards = std::min<uint32_t>(
+            target_code_object->specialization_prefix_length, n_args);
+        ShapeKey shape_keys[max_function_specialization_prefix_length];
+        for(uint32_t idx = 0; idx < n_guards; ++idx)
+        {
+            shape_keys[idx] = ShapeKey::from_value(first_arg[-int32_t(idx)]);
+        }
+        TrustedResolution resolution =
+            target_code_object->specialization_resolver(
+                thread->get_machine(), n_args, shape_keys[0], shape_keys[1]);
+        if(!resolution.has_trusted_handler())
+        {
+            return;
+        }
+        assert(uint32_t(resolution.arity) == n_args);
+
+        cache.adaptation = FunctionCallAdaptation::Specialized;
+        cache.n_specialization_guards = uint8_t(n_guards);
+        for(uint32_t idx = 0; idx < n_guards; ++idx)
+        {
+            cache.specialization_shape_keys[idx] = shape_keys[idx];
+        }
+        cache.specialized_handler = TrustedHandler::from_resolution(resolution);
+    }
+
+    // Runs the cached specialization when its argument shape guards hold.
+    // A mismatch demotes the site to an ordinary call of the complete
+    // function: a site that sees several shapes is not worth re-resolving.
+    static ALWAYSINLINE bool
+    try_invoke_function_specialization(ThreadState *thread,
+                                       FunctionCallInlineCache &cache,
+                                       const Value *first_arg, uint32_t n_args,
+                                       Value &accumulator)
+    {
+        assert(cache.adaptation == FunctionCallAdaptation::Specialized);
+        if(unlikely(!cache.specialization_matches(first_arg)))
+        {
+            cache.adaptation = function_call_adaptation_for_positional_call(
+                TValue<Function>::from_oop(cache.function), n_args);
+            cache.n_specialization_guards = 0;
+            cache.specialized_handler = TrustedHandler::none();
+            return false;
+        }
+
+        switch(n_args)
+        {
+            case 1:
+                accumulator =
+                    cache.specialized_handler.unary(thread, first_arg[0]);
+                return true;
+            case 2:
+                accumulator = cache.specialized_handler.binary(
+                    thread, first_arg[0], first_arg[-1]);
+                return true;
+            case 3:
+                accumulator = cache.specialized_handler.ternary(
+                    thread, first_arg[0], first_arg[-1], first_arg[-2]);
+                return true;
+        }
+        __builtin_unreachable();
+    }
+
     static ALWAYSINLINE bool
     function_call_cache_matches(const FunctionCallInlineCache &cache, Value fun,
                                 uint32_t n_args)
@@ -1742,6 +1884,7 @@ namespace cl
         CodeObject *&code_object, FunctionCallInlineCache &cache,
         int32_t first_arg_reg, uint32_t n_args, uint32_t instr_len)
     {
+        assert(cache.adaptation != FunctionCallAdaptation::Specialized);
         TValue<Function> function = TValue<Function>::from_oop(cache.function);
         if(likely(cache.adaptation == FunctionCallAdaptation::FixedArity))
         {
@@ -1789,12 +1932,51 @@ namespace cl
         return true;
     }
 
+    // Keyword values staged in caller registers by CallKeyword and the
+    // method-call keyword opcodes. The names tuple is only needed when some
+    // keyword lands in the callee's **kwargs dict.
+    struct FrameKeywordValues
+    {
+        const Value *first_value;
+        const CodeObject *code_object;
+        uint8_t keyword_names_idx;
+
+        Value value_at(uint32_t kw_idx) const
+        {
+            return first_value[-int32_t(kw_idx)];
+        }
+
+        TValue<Tuple> names() const
+        {
+            return TValue<Tuple>::from_value_assumed(
+                code_object->constant_table[keyword_names_idx].value());
+        }
+    };
+
+    // Keyword values expanded from a `**mapping` argument. They live in heap
+    // tuples rather than caller registers, since the caller has no fixed
+    // register span for a dynamic number of keywords.
+    struct UnpackedKeywordValues
+    {
+        TValue<Tuple> keyword_names;
+        TValue<Tuple> keyword_values;
+
+        Value value_at(uint32_t kw_idx) const
+        {
+            return keyword_values.extract()->item_unchecked(kw_idx);
+        }
+
+        TValue<Tuple> names() const { return keyword_names; }
+    };
+
+    template <typename KeywordValues>
     static ALWAYSINLINE DispatchTableEntry
-    enter_function_frame_from_keyword_args(
+    enter_function_frame_from_keyword_values(
         ThreadState *thread, Value *&fp, const uint8_t *&pc, void *&dispatch,
         CodeObject *&code_object, KeywordCallInlineCache &cache,
-        int32_t first_arg_reg, uint32_t n_pos_args, int32_t first_kw_value_reg,
-        uint32_t n_kw_args, uint8_t keyword_names_idx, uint32_t instr_len)
+        int32_t first_arg_reg, uint32_t n_pos_args,
+        const KeywordValues &keyword_values, uint32_t n_kw_args,
+        uint32_t instr_len)
     {
         TValue<Function> fun = TValue<Function>::from_oop(cache.function);
         Value *new_fp = new_frame_pointer_from_first_arg(fp, cache.code_object,
@@ -1840,15 +2022,12 @@ namespace cl
         if(unlikely(cache.adaptation == FunctionCallAdaptation::Full &&
                     has_kwargs))
         {
-            Value keyword_names_value =
-                code_object->constant_table[keyword_names_idx].value();
-            TValue<Tuple> keyword_names =
-                TValue<Tuple>::from_value_assumed(keyword_names_value);
+            TValue<Tuple> keyword_names = keyword_values.names();
             assert(keyword_names.extract()->size() == n_kw_args);
             for(uint32_t kw_idx = 0; kw_idx < n_kw_args; ++kw_idx)
             {
                 int8_t dest = cache.keyword_dest_regs[kw_idx];
-                Value value = fp[first_kw_value_reg - int32_t(kw_idx)];
+                Value value = keyword_values.value_at(kw_idx);
                 if(dest == KeywordDestKwargsDict)
                 {
                     assert(kwargs_dict != nullptr);
@@ -1867,7 +2046,7 @@ namespace cl
             {
                 int8_t dest = cache.keyword_dest_regs[kw_idx];
                 assert(dest != KeywordDestKwargsDict);
-                new_fp[dest] = fp[first_kw_value_reg - int32_t(kw_idx)];
+                new_fp[dest] = keyword_values.value_at(kw_idx);
             }
         }
 
@@ -1875,6 +2054,189 @@ namespace cl
                                          cache.code_object, new_fp, instr_len);
     }
 
+    static ALWAYSINLINE DispatchTableEntry
+    enter_function_frame_from_keyword_args(
+        ThreadState *thread, Value *&fp, const uint8_t *&pc, void *&dispatch,
+        CodeObject *&code_object, KeywordCallInlineCache &cache,
+        int32_t first_arg_reg, uint32_t n_pos_args, int32_t first_kw_value_reg,
+        uint32_t n_kw_args, uint8_t keyword_names_idx, uint32_t instr_len)
+    {
+        FrameKeywordValues keyword_values{fp + first_kw_value_reg, code_object,
+                                          keyword_names_idx};
+        return enter_function_frame_from_keyword_values(
+            thread, fp, pc, dispatch, code_object, cache, first_arg_reg,
+            n_pos_args, keyword_values, n_kw_args, instr_len);
+    }
+
+    // Slots kept free below an unpacked call's argument window so the callee
+    // frame still fits on the Clover stack.
+    static constexpr size_t UnpackedCallStackHeadroomSlots = 4096;
+
+    // Copies `self` (when present) followed by the items of a `*args` list or
+    // tuple into the dynamic argument area past the caller's temporaries. The
+    // callee frame is built directly over these slots, so a fixed-arity
+    // callee receives its parameters without an intermediate tuple.
+    static ALWAYSINLINE Expected<uint32_t>
+    stage_unpacked_positional_arguments(ThreadState *thread, Value *fp,
+                                        int32_t first_arg_reg, Value self,
+                                        Value args)
+    {
+        const Tuple *tuple = try_convert_to<Tuple>(args);
+        const List *list =
+            tuple == nullptr ? try_convert_to<List>(args) : nullptr;
+        if(unlikely(tuple == nullptr && list == nullptr))
+        {
+            return Expected<uint32_t>::raise_exception(
+                L"TypeError", L"argument after * must be a list or tuple");
+        }
+
+        size_t n_items = tuple != nullptr ? tuple->size() : list->size();
+        uint32_t n_self = self.is_not_present() ? 0 : 1;
+        const Value *arg_window_top = fp + first_arg_reg;
+        size_t available_slots =
+            size_t(arg_window_top - thread->clover_stack_begin());
+        if(unlikely(n_items + n_self + UnpackedCallStackHeadroomSlots >
+                    available_slots))
+        {
+            return Expected<uint32_t>::raise_exception(
+                L"OverflowError", L"too many arguments in unpacked call");
+        }
+
+        if(n_self != 0)
+        {
+            fp[first_arg_reg] = self;
+        }
+        Value *first_item_slot = fp + first_arg_reg - int32_t(n_self);
+        if(tuple != nullptr)
+        {
+            for(size_t idx = 0; idx < n_items; ++idx)
+            {
+                first_item_slot[-int32_t(idx)] = tuple->item_unchecked(idx);
+            }
+        }
+        else
+        {
+            for(size_t idx = 0; idx < n_items; ++idx)
+            {
+                first_item_slot[-int32_t(idx)] = list->item_unchecked(idx);
+            }
+        }
+        return Expected<uint32_t>::ok(uint32_t(n_items) + n_self);
+    }
+
+    static Expected<void> merge_unpack_kwargs_mapping(ThreadState *thread,
+                                                      Dict *merged,
+                                                      Value mapping)
+    {
+        const Dict *source = try_convert_to<Dict>(mapping);
+        if(unlikely(source == nullptr))
+        {
+            return Expected<void>::raise_exception(
+                L"TypeError", L"argument after ** must be a dict");
+        }
+        for(Dict::EntryView entry: *source)
+        {
+            if(unlikely(!can_convert_to<String>(entry.key)))
+            {
+                return Expected<void>::raise_exception(
+                    L"TypeError", L"keywords must be strings");
+            }
+            TValue<String> name =
+                TValue<String>::from_value_assumed(entry.key);
+            if(unlikely(CL_TRY(merged->contains_for_str(thread, name))))
+            {
+                return Expected<void>::raise_exception(
+                    L"TypeError", L"got multiple values for keyword argument");
+            }
+            CL_TRY(merged->set_item_for_str(thread, name, entry.value));
+        }
+        return Expected<void>::ok();
+    }
+
+    // CallUnpackKeyword. The keyword call cache depends on the keyword names,
+    // which vary per call here, so the adaptation plan is rebuilt into a local
+    // cache every time. An empty `**kwargs` degrades to a positional call.
+    NOINLINE static Expected<DispatchTableEntry> enter_unpacked_keyword_call(
+        ThreadState *thread, Value *&fp, const uint8_t *&pc, void *&dispatch,
+        CodeObject *&code_object, Value callable, Value self, Value args,
+        Value kwargs, uint32_t instr_len)
+    {
+        const Dict *kwargs_dict = try_convert_to<Dict>(kwargs);
+        if(unlikely(kwargs_dict == nullptr))
+        {
+            return Expected<DispatchTableEntry>::raise_exception(
+                L"TypeError", L"argument after ** must be a dict");
+        }
+        int32_t first_arg_reg = code_object->get_first_free_arg_encoded_reg();
+        if(kwargs_dict->empty())
+        {
+            uint32_t n_args = CL_TRY(stage_unpacked_positional_arguments(
+                thread, fp, first_arg_reg, self, args));
+            FunctionCallInlineCache local_cache;
+            CL_TRY(populate_positional_call_cache_from_callable(
+                callable, n_args, local_cache));
+            DispatchTableEntry jit_entry = enter_positional_call_from_cache(
+                thread, fp, pc, dispatch, code_object, local_cache,
+                first_arg_reg, n_args, instr_len);
+            return Expected<DispatchTableEntry>::ok(jit_entry);
+        }
+
+        uint32_t n_kw_args = uint32_t(kwargs_dict->size());
+        if(unlikely(n_kw_args > UINT8_MAX))
+        {
+            return Expected<DispatchTableEntry>::raise_exception(
+                L"OverflowError", L"too many arguments in unpacked call");
+        }
+
+        TValue<Tuple> keyword_names =
+            thread->make_object_value<Tuple>(n_kw_args);
+        TValue<Tuple> keyword_values =
+            thread->make_object_value<Tuple>(n_kw_args);
+        uint32_t kw_idx = 0;
+        for(Dict::EntryView entry: *kwargs_dict)
+        {
+            const String *name = try_convert_to<String>(entry.key);
+            if(unlikely(name == nullptr))
+            {
+                return Expected<DispatchTableEntry>::raise_exception(
+                    L"TypeError", L"keywords must be strings");
+            }
+            // Keyword call plans match parameter names by identity.
+            Value interned_name = entry.key;
+            if(!interned_name.is_interned_ptr())
+            {
+                interned_name =
+                    thread->get_machine()
+                        ->get_or_create_interned_string_value(std::wstring(
+                            name->data, size_t(name->count.extract())))
+                        .raw_value();
+            }
+            keyword_names.extract()->initialize_item_unchecked(kw_idx,
+                                                               interned_name);
+            keyword_values.extract()->initialize_item_unchecked(kw_idx,
+                                                                entry.value);
+            ++kw_idx;
+        }
+
+        uint32_t n_pos_args = CL_TRY(stage_unpacked_positional_arguments(
+            thread, fp, first_arg_reg, self, args));
+        if(unlikely(n_pos_args > UINT8_MAX))
+        {
+            return Expected<DispatchTableEntry>::raise_exception(
+                L"OverflowError", L"too many arguments in unpacked call");
+        }
+
+        KeywordCallInlineCache local_cache;
+        CL_TRY(populate_keyword_call_cache_from_callable(
+            callable, keyword_names.raw_value(), n_pos_args, n_kw_args,
+            local_cache));
+        UnpackedKeywordValues unpacked_values{keyword_names, keyword_values};
+        DispatchTableEntry jit_entry = enter_function_frame_from_keyword_values(
+            thread, fp, pc, dispatch, code_object, local_cache, first_arg_reg,
+            n_pos_args, unpacked_values, n_kw_args, instr_len);
+        return Expected<DispatchTableEntry>::ok(jit_entry);
+    }
+
     static ALWAYSINLINE int32_t prepare_method_call_argument_slots(
         Value *fp, int32_t receiver_reg, uint32_t n_user_args, Value self)
     {
@@ -2894,7 +3256,9 @@ namespace cl
             Shape *receiver_shape = receiver_object->get_shape();
             if(receiver_shape != nullptr &&
                !receiver_shape->has_flag(ShapeFlag::IsClassObject) &&
-               receiver_shape->allows_attribute_add_delete())
+               receiver_shape->allows_attribute_add_delete() &&
+               !receiver_object->uses_dictionary_mode_for(
+                   attr_name, ShapeTransitionVerb::Add))
             {
                 Shape *next_shape = receiver_shape->derive_transition(
                     attr_name, ShapeTransitionVerb::Add);
@@ -3231,6 +3595,81 @@ namespace cl
         COMPLETE();
     }
 
+    NOINLINE static INTERP_CC Value op_load_method_attr_slow(PARAMS)
+    {
+        START(4);
+        int8_t reg = pc[1];
+        uint8_t const_offset = pc[2];
+        uint8_t cache_idx = pc[3];
+        Value receiver = fp[reg];
+        TValue<String> attr_name = TValue<String>::from_value_assumed(
+            code_object->constant_table[const_offset].value());
+        AttributeReadInlineCache &cache =
+            code_object->inline_caches.attribute_read_caches[cache_idx];
+        Value callable;
+        Value self;
+        MethodCallTargetStatus target_status;
+        if(cache.matches(receiver))
+        {
+            target_status = prepare_method_call_target_from_plan(
+                receiver, cache.plan, callable, self);
+        }
+        else
+        {
+            AttributeReadDescriptor descriptor =
+                resolve_attr_read_descriptor(receiver, attr_name);
+            target_status = prepare_method_call_target_from_descriptor(
+                receiver, descriptor, callable, self);
+            if(target_status == MethodCallTargetStatus::Ready &&
+               descriptor.is_cacheable())
+            {
+                cache.populate(receiver, descriptor);
+            }
+        }
+        if(unlikely(target_status == MethodCallTargetStatus::Missing))
+        {
+            MUSTTAIL return method_lookup_error(ARGS);
+        }
+        if(unlikely(target_status ==
+                    MethodCallTargetStatus::RequiresDescriptorDispatch))
+        {
+            MUSTTAIL return descriptor_dispatch_error(ARGS);
+        }
+        fp[reg] = self;
+        accumulator = callable;
+        COMPLETE();
+    }
+
+    // Method lookup for calls that cannot use the fused method-call opcodes,
+    // such as `obj.f(*args)`. The callable goes to the accumulator and the
+    // receiver register is overwritten with the bound self, or cleared when
+    // the attribute is not a method.
+    static INTERP_CC Value op_load_method_attr(PARAMS)
+    {
+        START(4);
+        int8_t reg = pc[1];
+        uint8_t cache_idx = pc[3];
+        Value receiver = fp[reg];
+        AttributeReadInlineCache &cache =
+            code_object->inline_caches.attribute_read_caches[cache_idx];
+        if(unlikely(!cache.matches(receiver)))
+        {
+            MUSTTAIL return op_load_method_attr_slow(ARGS);
+        }
+        Value callable;
+        Value self;
+        MethodCallFastTargetStatus target_status =
+            prepare_method_call_target_from_plan_fast(receiver, cache.plan,
+                                                      callable, self);
+        if(unlikely(target_status == MethodCallFastTargetStatus::Slow))
+        {
+            MUSTTAIL return op_load_method_attr_slow(ARGS);
+        }
+        fp[reg] = self;
+        accumulator = callable;
+        COMPLETE();
+    }
+
     NOINLINE static INTERP_CC Value op_store_attr_cached_slow(PARAMS)
     {
         START(4);
@@ -3922,7 +4361,7 @@ namespace cl
         int8_t reg = pc[1];
         Value a = fp[reg];
         Value b = accumulator;
-        if(likely(!a.is_ptr() && !b.is_ptr()))
+        if(likely(a.has_bitwise_equality() && b.has_bitwise_equality()))
         {
             // See if we have a bit difference after clearing the bit that
             // promotes booleans to 0/1 integers.
@@ -3940,7 +4379,7 @@ namespace cl
         int8_t reg = pc[1];
         Value a = fp[reg];
         Value b = accumulator;
-        if(likely(!a.is_ptr() && !b.is_ptr()))
+        if(likely(a.has_bitwise_equality() && b.has_bitwise_equality()))
         {
             // See if we have a bit difference after clearing the bit that
             // promotes booleans to 0/1 integers.
@@ -4036,9 +4475,9 @@ namespace cl
         {
             value = static_cast<double>(a.get_smi());
         }
-        else if(can_convert_to<Float>(a))
+        else if(is_float_value(a))
         {
-            value = a.get_ptr<Float>()->value();
+            value = float_value(a);
         }
         else
         {
@@ -4050,8 +4489,7 @@ namespace cl
             MUSTTAIL return op_sqrt_domain_error(ARGS);
         }
 
-        accumulator =
-            thread->make_object_value<Float>(std::sqrt(value)).raw_value();
+        accumulator = box_float(thread, std::sqrt(value));
         COMPLETE();
     }
 
@@ -4564,6 +5002,84 @@ namespace cl
         COMPLETE();
     }
 
+    // Concatenates the positional segments of a call with several `*`
+    // arguments into one tuple for CallUnpack.
+    static INTERP_CC Value op_concat_unpack_args(PARAMS)
+    {
+        START(3);
+        int8_t reg = pc[1];
+        uint8_t n_segments = pc[2];
+
+        size_t n_items = 0;
+        for(uint8_t idx = 0; idx < n_segments; ++idx)
+        {
+            Value segment = fp[int32_t(reg) - int32_t(idx)];
+            if(const Tuple *tuple = try_convert_to<Tuple>(segment))
+            {
+                n_items += tuple->size();
+            }
+            else if(const List *list = try_convert_to<List>(segment))
+            {
+                n_items += list->size();
+            }
+            else
+            {
+                MUSTTAIL return unpack_args_type_error(ARGS);
+            }
+        }
+
+        TValue<Tuple> tuple = thread->make_object_value<Tuple>(n_items);
+        size_t item_idx = 0;
+        for(uint8_t idx = 0; idx < n_segments; ++idx)
+        {
+            Value segment = fp[int32_t(reg) - int32_t(idx)];
+            if(const Tuple *source = try_convert_to<Tuple>(segment))
+            {
+                for(size_t src_idx = 0; src_idx < source->size(); ++src_idx)
+                {
+                    tuple.extract()->initialize_item_unchecked(
+                        item_idx++, source->item_unchecked(src_idx));
+                }
+            }
+            else
+            {
+                const List *list = assume_convert_to<List>(segment);
+                for(size_t src_idx = 0; src_idx < list->size(); ++src_idx)
+                {
+                    tuple.extract()->initialize_item_unchecked(
+                        item_idx++, list->item_unchecked(src_idx));
+                }
+            }
+        }
+        accumulator = tuple.raw_value();
+
+        COMPLETE();
+    }
+
+    // Merges the keyword segments of a call with several `**` arguments into
+    // one dict for CallUnpackKeyword, rejecting repeated keywords.
+    static INTERP_CC Value op_merge_unpack_kwargs(PARAMS)
+    {
+        START(3);
+        int8_t reg = pc[1];
+        uint8_t n_mappings = pc[2];
+
+        set_clover_frame_frontier_for_native_call(thread, fp, code_object);
+        TValue<Dict> merged = thread->make_object_value<Dict>();
+        for(uint8_t idx = 0; idx < n_mappings; ++idx)
+        {
+            Expected<void> inserted = merge_unpack_kwargs_mapping(
+                thread, merged.extract(), fp[int32_t(reg) - int32_t(idx)]);
+            if(unlikely(inserted.has_exception()))
+            {
+                MUSTTAIL return propagate_pending_exception(ARGS);
+            }
+        }
+        accumulator = merged.raw_value();
+
+        COMPLETE();
+    }
+
     static INTERP_CC Value op_create_class(PARAMS)
     {
         static constexpr uint32_t create_class_instr_len = 3;
@@ -4627,6 +5143,13 @@ namespace cl
         int16_t rel_target = read_int16_le(&pc[1]);
         pc += 3;
         pc += rel_target;
+        // Loop back edges are the only unbounded path without a call, so
+        // they poll too. The accumulator is dead at the loop head. A for
+        // loop closes with a backward Jump.
+        if(rel_target < 0 && unlikely(thread->safepoint_requested()))
+        {
+            MUSTTAIL return op_committed_safepoint_slow(ARGS);
+        }
 
         START(0);
         COMPLETE();
@@ -4644,6 +5167,11 @@ namespace cl
         if(accumulator.is_truthy())
         {
             pc += rel_target;
+            // A while loop closes with a backward JumpIfTrue.
+            if(rel_target < 0 && unlikely(thread->safepoint_requested()))
+            {
+                MUSTTAIL return op_committed_safepoint_slow(ARGS);
+            }
         }
 
         START(0);
@@ -4707,6 +5235,11 @@ namespace cl
         MUSTTAIL return raise_bare(ARGS);
     }
 
+    static INTERP_CC Value op_reraise_unwind(PARAMS)
+    {
+        MUSTTAIL return reraise_unwind(ARGS);
+    }
+
     NOINLINE static INTERP_CC Value op_call_positional_slow(PARAMS)
     {
         static constexpr uint32_t call_instr_len = 5;
@@ -4721,6 +5254,20 @@ namespace cl
         {
             INTERP_TRY(populate_positional_call_cache_from_callable(
                 callable, n_args, call_cache));
+            populate_function_call_specialization(thread, call_cache,
+                                                  fp + first_arg_reg, n_args);
+        }
+        if(call_cache.adaptation == FunctionCallAdaptation::Specialized &&
+           try_invoke_function_specialization(thread, call_cache,
+                                              fp + first_arg_reg, n_args,
+                                              accumulator))
+        {
+            if(unlikely(accumulator.is_exception_marker()))
+            {
+                MUSTTAIL return propagate_pending_exception(ARGS);
+            }
+            START(call_instr_len);
+            COMPLETE();
         }
         DispatchTableEntry jit_entry = enter_positional_call_from_cache(
             thread, fp, pc, dispatch, code_object, call_cache, first_arg_reg,
@@ -4791,6 +5338,127 @@ namespace cl
         COMPLETE();
     }
 
+    NOINLINE static INTERP_CC Value op_call_global_simple_slow(PARAMS)
+    {
+        static constexpr uint32_t call_instr_len = 7;
+        uint8_t name_idx = pc[1];
+        uint8_t global_cache_idx = pc[2];
+        int8_t callable_reg = pc[3];
+        int8_t first_arg_reg = pc[4];
+        uint8_t n_args = pc[5];
+        uint8_t call_cache_idx = pc[6];
+        ModuleGlobalReadInlineCache &global_cache =
+            code_object->inline_caches
+                .module_global_read_caches[global_cache_idx];
+        Value callable;
+        if(likely(global_cache.matches()))
+        {
+            callable = load_module_global_slot_from_plan_inline(
+                global_cache.slot);
+        }
+        else
+        {
+            TValue<String> name = TValue<String>::from_value_assumed(
+                code_object->constant_table[name_idx].value());
+            ModuleObject *module = code_object->get_defining_module().extract();
+            ModuleGlobalReadDescriptor descriptor =
+                resolve_module_global_read_descriptor(module, name);
+            if(descriptor.is_cacheable())
+            {
+                global_cache.populate(descriptor);
+            }
+            callable = load_module_global_from_plan(descriptor.plan);
+            if(unlikely(callable.is_not_present()))
+            {
+                MUSTTAIL return module_global_name_error(ARGS);
+            }
+        }
+        fp[callable_reg] = callable;
+
+        FunctionCallInlineCache &call_cache =
+            code_object->inline_caches.function_call_caches[call_cache_idx];
+        if(unlikely(!function_call_cache_matches(call_cache, callable, n_args)))
+        {
+            INTERP_TRY(populate_positional_call_cache_from_callable(
+                callable, n_args, call_cache));
+            populate_function_call_specialization(thread, call_cache,
+                                                  fp + first_arg_reg, n_args);
+        }
+        if(call_cache.adaptation == FunctionCallAdaptation::Specialized &&
+           try_invoke_function_specialization(thread, call_cache,
+                                              fp + first_arg_reg, n_args,
+                                              accumulator))
+        {
+            if(unlikely(accumulator.is_exception_marker()))
+            {
+                MUSTTAIL return propagate_pending_exception(ARGS);
+            }
+            START(call_instr_len);
+            COMPLETE();
+        }
+        DispatchTableEntry jit_entry = enter_positional_call_from_cache(
+            thread, fp, pc, dispatch, code_object, call_cache, first_arg_reg,
+            n_args, call_instr_len);
+        if(jit_entry != nullptr)
+        {
+            MUSTTAIL return jit_entry(ARGS);
+        }
+        if(unlikely(thread->safepoint_requested()))
+        {
+            MUSTTAIL return op_committed_safepoint_slow(ARGS);
+        }
+
+        START(0);
+        COMPLETE();
+    }
+
+    // Fused LdaGlobal; Star; CallPositional. The callable is still written to
+    // its register so the caller frame keeps it alive for the duration of the
+    // call, exactly as the unfused sequence would.
+    static INTERP_CC Value op_call_global_simple(PARAMS)
+    {
+        static constexpr uint32_t call_instr_len = 7;
+        uint8_t global_cache_idx = pc[2];
+        int8_t callable_reg = pc[3];
+        int8_t first_arg_reg = pc[4];
+        uint8_t n_args = pc[5];
+        uint8_t call_cache_idx = pc[6];
+        ModuleGlobalReadInlineCache &global_cache =
+            code_object->inline_caches
+                .module_global_read_caches[global_cache_idx];
+        if(unlikely(!global_cache.matches()))
+        {
+            MUSTTAIL return op_call_global_simple_slow(ARGS);
+        }
+        Value fun = load_module_global_slot_from_plan_inline(global_cache.slot);
+        FunctionCallInlineCache &call_cache =
+            code_object->inline_caches.function_call_caches[call_cache_idx];
+        if(unlikely(!function_call_cache_matches(call_cache, fun, n_args)))
+        {
+            MUSTTAIL return op_call_global_simple_slow(ARGS);
+        }
+        if(unlikely(call_cache.adaptation !=
+                    FunctionCallAdaptation::FixedArity))
+        {
+            MUSTTAIL return op_call_global_simple_slow(ARGS);
+        }
+        fp[callable_reg] = fun;
+        DispatchTableEntry jit_entry = enter_fixed_positional_call_from_cache(
+            thread, fp, pc, dispatch, code_object, call_cache, first_arg_reg,
+            call_instr_len);
+        if(jit_entry != nullptr)
+        {
+            MUSTTAIL return jit_entry(ARGS);
+        }
+        if(unlikely(thread->safepoint_requested()))
+        {
+            MUSTTAIL return op_committed_safepoint_slow(ARGS);
+        }
+
+        START(0);
+        COMPLETE();
+    }
+
     NOINLINE static INTERP_CC Value op_call_keyword_slow(PARAMS)
     {
         static constexpr uint32_t call_instr_len = 8;
@@ -4865,6 +5533,66 @@ namespace cl
         COMPLETE();
     }
 
+    // Caller-side `*args` call. The positional call cache keys on the runtime
+    // argument count, so a forwarding wrapper that always passes the same
+    // arity keeps hitting the cached fixed-arity plan.
+    static INTERP_CC Value op_call_unpack(PARAMS)
+    {
+        static constexpr uint32_t call_instr_len = 5;
+        int8_t callable_reg = pc[1];
+        int8_t self_reg = pc[2];
+        int8_t args_reg = pc[3];
+        uint8_t cache_idx = pc[4];
+        Value callable = fp[callable_reg];
+        int32_t first_arg_reg = code_object->get_first_free_arg_encoded_reg();
+        uint32_t n_args = INTERP_TRY(stage_unpacked_positional_arguments(
+            thread, fp, first_arg_reg, fp[self_reg], fp[args_reg]));
+        FunctionCallInlineCache &cache =
+            code_object->inline_caches.function_call_caches[cache_idx];
+        if(unlikely(!function_call_cache_matches(cache, callable, n_args)))
+        {
+            INTERP_TRY(populate_positional_call_cache_from_callable(
+                callable, n_args, cache));
+        }
+        DispatchTableEntry jit_entry = enter_positional_call_from_cache(
+            thread, fp, pc, dispatch, code_object, cache, first_arg_reg, n_args,
+            call_instr_len);
+        if(jit_entry != nullptr)
+        {
+            MUSTTAIL return jit_entry(ARGS);
+        }
+        if(unlikely(thread->safepoint_requested()))
+        {
+            MUSTTAIL return op_committed_safepoint_slow(ARGS);
+        }
+
+        START(0);
+        COMPLETE();
+    }
+
+    static INTERP_CC Value op_call_unpack_keyword(PARAMS)
+    {
+        static constexpr uint32_t call_instr_len = 5;
+        int8_t callable_reg = pc[1];
+        int8_t self_reg = pc[2];
+        int8_t args_reg = pc[3];
+        int8_t kwargs_reg = pc[4];
+        DispatchTableEntry jit_entry = INTERP_TRY(enter_unpacked_keyword_call(
+            thread, fp, pc, dispatch, code_object, fp[callable_reg],
+            fp[self_reg], fp[args_reg], fp[kwargs_reg], call_instr_len));
+        if(jit_entry != nullptr)
+        {
+            MUSTTAIL return jit_entry(ARGS);
+        }
+        if(unlikely(thread->safepoint_requested()))
+        {
+            MUSTTAIL return op_committed_safepoint_slow(ARGS);
+        }
+
+        START(0);
+        COMPLETE();
+    }
+
     NOINLINE static INTERP_CC Value op_call_method_attr_positional_slow(PARAMS)
     {
         static constexpr uint32_t call_instr_len = 6;
@@ -6121,7 +6849,7 @@ namespace cl
         if(thread->pending_exception_kind() ==
            PendingExceptionKind::StopIteration)
         {
-            materialize_pending_stop_iteration(thread);
+            (void)thread->materialize_pending_exception_object();
         }
         else if(thread->pending_exception_kind() !=
                 PendingExceptionKind::Object)
@@ -6166,13 +6894,27 @@ namespace cl
     NOINLINE static INTERP_CC Value
     op_return_exception_marker_to_native_slow(PARAMS)
     {
-        MUSTTAIL return exception_marker_native_return_without_pending_exception_system_error(
-            ARGS);
+        if(!thread->has_pending_exception())
+        {
+            MUSTTAIL return exception_marker_native_return_without_pending_exception_system_error(
+                ARGS);
+        }
+
+        // Native callers only understand realized exception objects and the
+        // compact StopIteration protocol signal.
+        assert(thread->pending_exception_kind() == PendingExceptionKind::Class);
+        (void)thread->materialize_pending_exception_object();
+        Value *restored_fp =
+            decode_frame_payload_ptr<Value *>(fp[FrameHeaderPreviousFpOffset]);
+        thread->set_clover_frame_frontier(restored_fp);
+        return Value::exception_marker();
     }
 
     static INTERP_CC Value op_return_exception_marker_to_native(PARAMS)
     {
-        if(unlikely(!thread->has_pending_exception()))
+        PendingExceptionKind kind = thread->pending_exception_kind();
+        if(unlikely(kind == PendingExceptionKind::None ||
+                    kind == PendingExceptionKind::Class))
         {
             MUSTTAIL return op_return_exception_marker_to_native_slow(ARGS);
         }
@@ -6246,6 +6988,7 @@ namespace cl
         SET_TABLE_ENTRY(Bytecode::DelGlobal, op_del_global);
         SET_TABLE_ENTRY(Bytecode::DelLocal, op_del_local);
         SET_TABLE_ENTRY(Bytecode::LoadAttr, op_load_attr);
+        SET_TABLE_ENTRY(Bytecode::LoadMethodAttr, op_load_method_attr);
         SET_TABLE_ENTRY(Bytecode::StoreAttr, op_store_attr);
         SET_TABLE_ENTRY(Bytecode::DelAttr, op_del_attr);
         SET_TABLE_ENTRY(Bytecode::GetItem, op_get_item);
@@ -6291,6 +7034,8 @@ namespace cl
         SET_TABLE_ENTRY(Bytecode::CreateDict, op_create_dict);
         SET_TABLE_ENTRY(Bytecode::CreateList, op_create_list);
         SET_TABLE_ENTRY(Bytecode::CreateTuple, op_create_tuple);
+        SET_TABLE_ENTRY(Bytecode::ConcatUnpackArgs, op_concat_unpack_args);
+        SET_TABLE_ENTRY(Bytecode::MergeUnpackKwargs, op_merge_unpack_kwargs);
         SET_TABLE_ENTRY(Bytecode::CreateBinarySlice, op_create_binary_slice);
         SET_TABLE_ENTRY(Bytecode::CreateTernarySlice, op_create_ternary_slice);
         SET_TABLE_ENTRY(Bytecode::CreateFunction, op_create_function);
@@ -6313,9 +7058,13 @@ namespace cl
         SET_TABLE_ENTRY(Bytecode::RaiseUnwindWithContext,
                         op_raise_unwind_with_context);
         SET_TABLE_ENTRY(Bytecode::RaiseBare, op_raise_bare);
+        SET_TABLE_ENTRY(Bytecode::ReraiseUnwind, op_reraise_unwind);
 
         SET_TABLE_ENTRY(Bytecode::CallPositional, op_call_positional);
+        SET_TABLE_ENTRY(Bytecode::CallGlobalSimple, op_call_global_simple);
         SET_TABLE_ENTRY(Bytecode::CallKeyword, op_call_keyword);
+        SET_TABLE_ENTRY(Bytecode::CallUnpack, op_call_unpack);
+        SET_TABLE_ENTRY(Bytecode::CallUnpackKeyword, op_call_unpack_keyword);
         SET_TABLE_ENTRY(Bytecode::CallIntrinsic0, op_call_intrinsic0);
         SET_TABLE_ENTRY(Bytecode::CallIntrinsic1, op_call_intrinsic1);
         SET_TABLE_ENTRY(Bytecode::CallIntrinsic2, op_call_intrinsic2);
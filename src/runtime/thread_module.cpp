@@ -0,0 +1,261 @@
+#include "runtime/thread_module.h"
+
+#include "builtin_types/dict.h"
+#include "builtin_types/float.h"
+#include "builtin_types/module_loader_object.h"
+#include "builtin_types/module_object.h"
+#include "builtin_types/module_spec_object.h"
+#include "builtin_types/tuple.h"
+#include "object_model/class_object.h"
+#include "object_model/native_function.h"
+#include "runtime/exception_propagation.h"
+#include "runtime/thread_scheduler.h"
+#include "runtime/thread_state.h"
+#include "runtime/virtual_machine.h"
+#include <optional>
+
+namespace cl
+{
+    // Longest lock wait accepted by acquire(timeout=...), in seconds.
+    static constexpr double kThreadTimeoutMax = 4294967.0;
+
+    static bool try_acquire_lock(ThreadLockObject *lock)
+    {
+        bool expected = false;
+        return lock->locked.compare_exchange_strong(expected, true,
+                                                    std::memory_order_acquire);
+    }
+
+    static Value native_lock_acquire(ThreadState *thread, Value self,
+                                     Value blocking, Value timeout)
+    {
+        ThreadLockObject *lock =
+            CL_TRY(TValue<ThreadLockObject>::from_value_or_raise(
+                       self, L"TypeError",
+                       L"lock.acquire expects a lock receiver"))
+                .extract();
+
+        std::optional<double> timeout_seconds;
+        if(timeout.is_smi())
+        {
+            if(timeout.get_smi() != -1)
+            {
+                timeout_seconds = double(timeout.get_smi());
+            }
+        }
+        else if(is_float_value(timeout))
+        {
+            double value = float_value(timeout);
+            if(value != -1.0)
+            {
+                timeout_seconds = value;
+            }
+        }
+        else
+        {
+            return thread->set_pending_builtin_exception_string(
+                L"TypeError", L"lock.acquire timeout must be a number");
+        }
+        if(timeout_seconds.has_value() && *timeout_seconds < 0.0)
+        {
+            return thread->set_pending_builtin_exception_string(
+                L"ValueError", L"timeout value must be a non-negative number");
+        }
+        if(!blocking.is_truthy() && timeout_seconds.has_value())
+        {
+            return thread->set_pending_builtin_exception_string(
+                L"ValueError",
+                L"can't specify a timeout for a non-blocking call");
+        }
+
+        if(try_acquire_lock(lock))
+        {
+            return Value::True();
+        }
+        if(!blocking.is_truthy())
+        {
+            return Value::False();
+        }
+        bool acquired = thread->get_machine()->thread_scheduler()
+                            .acquire_lock_blocking(thread, lock->locked,
+                                                   timeout_seconds);
+        return acquired ? Value::True() : Value::False();
+    }
+
+    static Value native_lock_enter(ThreadState *thread, Value self)
+    {
+        return native_lock_acquire(thread, self, Value::True(),
+                                   Value::from_smi(-1));
+    }
+
+    static Value native_lock_release(ThreadState *thread, Value self)
+    {
+        ThreadLockObject *lock =
+            CL_TRY(TValue<ThreadLockObject>::from_value_or_raise(
+                       self, L"TypeError",
+                       L"lock.release expects a lock receiver"))
+                .extract();
+        if(!lock->locked.load(std::memory_order_relaxed))
+        {
+            return thread->set_pending_builtin_exception_string(
+                L"RuntimeError", L"release unlocked lock");
+        }
+        thread->get_machine()->thread_scheduler().release_lock(lock->locked);
+        return Value::None();
+    }
+
+    static Value native_lock_exit(ThreadState *thread, Value self,
+                                  Value exc_type, Value exc_value,
+                                  Value exc_traceback)
+    {
+        (void)exc_type;
+        (void)exc_value;
+        (void)exc_traceback;
+        CL_PROPAGATE_EXCEPTION(native_lock_release(thread, self));
+        return Value::False();
+    }
+
+    static Value native_lock_locked(ThreadState *thread, Value self)
+    {
+        ThreadLockObject *lock =
+            CL_TRY(TValue<ThreadLockObject>::from_value_or_raise(
+                       self, L"TypeError",
+                       L"lock.locked expects a lock receiver"))
+                .extract();
+        return lock->locked.load(std::memory_order_relaxed) ? Value::True()
+                                                            : Value::False();
+    }
+
+    BuiltinClassDefinition make_thread_lock_class(VirtualMachine *vm)
+    {
+        static constexpr NativeLayoutId native_layout_ids[] = {
+            NativeLayoutId::ThreadLock};
+        ClassObject *cls = ClassObject::make_builtin_class<ThreadLockObject>(
+            vm->get_or_create_interned_string_value(L"lock"),
+            ThreadLockObject::native_static_release_count(), nullptr, 0,
+            vm->object_class());
+        return builtin_class_definition(cls, native_layout_ids,
+                                        BuiltinsVisibility::Internal);
+    }
+
+    void install_thread_lock_class_methods(VirtualMachine *vm)
+    {
+        Owned<TValue<Tuple>> acquire_defaults(
+            active_thread()->make_object_value<Tuple>(2));
+        acquire_defaults.extract()->initialize_item_unchecked(0,
+                                                              Value::True());
+        acquire_defaults.extract()->initialize_item_unchecked(
+            1, Value::from_smi(-1));
+        static constexpr const wchar_t *acquire_names[] = {L"blocking",
+                                                           L"timeout"};
+        BuiltinIntrinsicMethod methods[] = {
+            with_keyword_parameter_names(
+                with_defaults(builtin_intrinsic_method(
+                                  L"acquire", native_lock_acquire,
+                                  L"Acquire the lock, waiting if blocking."),
+                              acquire_defaults.value()),
+                acquire_names, 2, 1),
+            builtin_intrinsic_method(L"release", native_lock_release,
+                                     L"Release the lock."),
+            builtin_intrinsic_method(L"locked", native_lock_locked,
+                                     L"Return whether the lock is held."),
+            builtin_intrinsic_method(L"__enter__", native_lock_enter,
+                                     L"Acquire the lock."),
+            builtin_intrinsic_method(L"__exit__", native_lock_exit,
+                                     L"Release the lock."),
+        };
+        unwrap_bootstrap_expected(
+            vm,
+            install_builtin_intrinsic_methods(
+                vm, vm->class_for_native_layout(NativeLayoutId::ThreadLock),
+                methods, std::size(methods)),
+            "installing lock methods");
+    }
+
+    static Value thread_start_new_thread(ThreadState *thread, Value function,
+                                         Value args)
+    {
+        TValue<Function> function_value =
+            CL_TRY(TValue<Function>::from_value_or_raise(
+                function, L"TypeError", L"first arg must be callable"));
+        TValue<Tuple> args_value = CL_TRY(TValue<Tuple>::from_value_or_raise(
+            args, L"TypeError", L"2nd arg must be a tuple"));
+        return thread->get_machine()->thread_scheduler().start_thread(
+            function_value, args_value);
+    }
+
+    static Value thread_get_ident(ThreadState *thread)
+    {
+        return Value::from_smi(thread->thread_ident());
+    }
+
+    static Value thread_allocate_lock(ThreadState *thread)
+    {
+        return thread->make_object_value<ThreadLockObject>().raw_value();
+    }
+
+    static void install_thread_module_value(VirtualMachine *vm,
+                                            ModuleObject *module,
+                                            const wchar_t *name, Value value)
+    {
+        bool installed = module->set_own_property(
+            vm->get_or_create_interned_string_value(name), value);
+        assert(installed);
+        (void)installed;
+    }
+
+    void install_thread_module(VirtualMachine *vm)
+    {
+        TValue<String> module_name =
+            vm->get_or_create_interned_string_value(L"_thread");
+        TValue<String> empty_package =
+            vm->get_or_create_interned_string_value(L"");
+        ModuleLoaderObject *loader =
+            vm->make_immortal_object_raw<ModuleLoaderObject>(
+                vm->get_or_create_interned_string_value(L"builtin")
+                    .raw_value(),
+                Value::None(), Value::None());
+        ModuleSpecObject *spec = vm->make_immortal_object_raw<ModuleSpecObject>(
+            module_name.raw_value(), Value::from_oop(loader),
+            vm->get_or_create_interned_string_value(L"built-in").raw_value(),
+            Value::None(), Value::False(), empty_package.raw_value());
+        ModuleObject *module = vm->make_immortal_object_raw<ModuleObject>(
+            module_name, vm->global_builtins_module().raw_value(),
+            Value::None(), empty_package.raw_value(), Value::from_oop(loader),
+            Value::from_oop(spec), Value::not_present());
+
+        BuiltinIntrinsicMethod functions[] = {
+            builtin_intrinsic_method(
+                L"start_new_thread", thread_start_new_thread,
+                L"Run function(*args) on a new thread; return its ident."),
+            builtin_intrinsic_method(L"get_ident", thread_get_ident,
+                                     L"Return the current thread's ident."),
+            builtin_intrinsic_method(L"allocate_lock", thread_allocate_lock,
+                                     L"Return a new unlocked lock."),
+        };
+        for(const BuiltinIntrinsicMethod &function: functions)
+        {
+            install_thread_module_value(
+                vm, module, function.name,
+                unwrap_bootstrap_expected(
+                    vm, make_intrinsic_function(vm, function),
+                    "creating _thread function")
+                    .raw_value());
+        }
+        install_thread_module_value(
+            vm, module, L"LockType",
+            Value::from_oop(
+                vm->class_for_native_layout(NativeLayoutId::ThreadLock)));
+        install_thread_module_value(
+            vm, module, L"TIMEOUT_MAX",
+            vm->make_immortal_object_value<Float>(kThreadTimeoutMax)
+                .raw_value());
+
+        unwrap_bootstrap_expected(
+            vm,
+            vm->imported_modules().extract()->set_item_for_str(
+                vm->get_default_thread(), module_name, Value::from_oop(module)),
+            "installing _thread module");
+    }
+
+}  // namespace cl
@@ -0,0 +1,45 @@
+#ifndef CL_THREAD_MODULE_H
+#define CL_THREAD_MODULE_H
+
+#include "object_model/builtin_class_registry.h"
+#include "object_model/object.h"
+#include "object_model/value.h"
+#include <atomic>
+#include <type_traits>
+
+namespace cl
+{
+    class ClassObject;
+    class VirtualMachine;
+
+    // _thread.LockType: a non-reentrant lock that any thread may release.
+    // The flag is flipped with a compare-and-swap so an uncontended acquire
+    // never enters the scheduler; contended acquires wait detached.
+    class ThreadLockObject : public Object
+    {
+    public:
+        static constexpr NativeLayoutId native_layout =
+            NativeLayoutId::ThreadLock;
+
+        explicit ThreadLockObject(ClassObject *cls)
+            : Object(cls, native_layout)
+        {
+        }
+
+        std::atomic<bool> locked{false};
+
+        CL_DECLARE_STATIC_VALUE_SPAN_EXTENDS(ThreadLockObject, Object, 0);
+        CL_DECLARE_STATIC_OBJECT_SIZE(ThreadLockObject);
+    };
+
+    static_assert(std::is_trivially_destructible_v<ThreadLockObject>);
+
+    BuiltinClassDefinition make_thread_lock_class(VirtualMachine *vm);
+    void install_thread_lock_class_methods(VirtualMachine *vm);
+
+    // Creates the builtin _thread module and registers it in sys.modules.
+    void install_thread_module(VirtualMachine *vm);
+
+}  // namespace cl
+
+#endif  // CL_THREAD_MODULE_H
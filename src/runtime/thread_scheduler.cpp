@@ -0,0 +1,234 @@
+#include "runtime/thread_scheduler.h"
+
+#include "builtin_types/tuple.h"
+#include "object_model/function.h"
+#include "object_model/refcount.h"
+#include "runtime/thread_state.h"
+#include "runtime/virtual_machine.h"
+#include <cassert>
+#include <thread>
+
+namespace cl
+{
+    struct ThreadScheduler::StartedThread
+    {
+        ThreadState *thread;
+        // Owned references, released by the started thread once it has run.
+        Value function;
+        Value args;
+        std::thread os_thread;
+        std::atomic<bool> finished{false};
+    };
+
+    ThreadScheduler::ThreadScheduler(VirtualMachine *_vm) : vm(_vm) {}
+
+    ThreadScheduler::~ThreadScheduler()
+    {
+        for(const std::unique_ptr<StartedThread> &started: started_threads)
+        {
+            assert(!started->os_thread.joinable());
+            (void)started;
+        }
+    }
+
+    void ThreadScheduler::register_main_thread(ThreadState *thread)
+    {
+        thread->thread_ident_ = next_thread_ident++;
+        attach(thread);
+    }
+
+    void ThreadScheduler::request_safepoint_from_waiter()
+    {
+        std::atomic_ref<bool>(*vm->safepoint_requested_ptr())
+            .store(true, std::memory_order_relaxed);
+    }
+
+    void ThreadScheduler::attach(ThreadState *thread)
+    {
+        std::unique_lock<std::mutex> lock(attach_mutex);
+        uint64_t ticket = next_attach_ticket++;
+        auto my_turn = [this, ticket] {
+            return attached_thread == nullptr &&
+                   serving_attach_ticket == ticket;
+        };
+        while(!my_turn())
+        {
+            if(!attach_cv.wait_for(lock, kSwitchInterval, my_turn))
+            {
+                request_safepoint_from_waiter();
+            }
+        }
+        ++serving_attach_ticket;
+        attached_thread = thread;
+    }
+
+    bool ThreadScheduler::detach(ThreadState *thread)
+    {
+        {
+            std::lock_guard<std::mutex> lock(attach_mutex);
+            if(attached_thread != thread)
+            {
+                return false;
+            }
+            attached_thread = nullptr;
+        }
+        attach_cv.notify_all();
+        return true;
+    }
+
+    void ThreadScheduler::yield(ThreadState *thread)
+    {
+        {
+            std::lock_guard<std::mutex> lock(attach_mutex);
+            if(attached_thread != thread ||
+               next_attach_ticket == serving_attach_ticket)
+            {
+                return;
+            }
+        }
+        detach(thread);
+        attach(thread);
+    }
+
+    Value ThreadScheduler::start_thread(TValue<Function> function,
+                                        TValue<Tuple> args)
+    {
+        reap_finished_threads();
+
+        ThreadState *thread;
+        if(!idle_threads.empty())
+        {
+            thread = idle_threads.back();
+            idle_threads.pop_back();
+        }
+        else
+        {
+            thread = vm->make_new_thread();
+        }
+        int64_t ident = next_thread_ident++;
+        thread->thread_ident_ = ident;
+
+        std::unique_ptr<StartedThread> started =
+            std::make_unique<StartedThread>();
+        started->thread = thread;
+        started->function = incref(function.raw_value());
+        started->args = incref(args.raw_value());
+        StartedThread *record = started.get();
+        // Built without exceptions: a failed OS thread start aborts.
+        record->os_thread =
+            std::thread([this, record] { run_started_thread(record); });
+        started_threads.push_back(std::move(started));
+        return Value::from_smi(ident);
+    }
+
+    void ThreadScheduler::run_started_thread(StartedThread *started)
+    {
+        ThreadState *thread = started->thread;
+        attach(thread);
+        {
+            ThreadState::ActivationScope activation_scope(thread);
+            Value result = thread->call_clovervm_function_with_tuple(
+                TValue<Function>::from_value_assumed(started->function),
+                TValue<Tuple>::from_value_assumed(started->args));
+            if(result.is_exception_marker())
+            {
+                // threading.Thread reports its own exceptions; a bare
+                // start_new_thread() target that raises just ends.
+                thread->clear_pending_exception();
+            }
+            decref(started->function);
+            decref(started->args);
+            started->function = Value::None();
+            started->args = Value::None();
+            thread->publish_safepoint_scan_record(
+                thread->clover_frame_sentinel(), Value::not_present());
+        }
+        idle_threads.push_back(thread);
+        started->finished.store(true, std::memory_order_release);
+        detach(thread);
+    }
+
+    void ThreadScheduler::reap_finished_threads()
+    {
+        size_t keep = 0;
+        for(size_t idx = 0; idx < started_threads.size(); ++idx)
+        {
+            std::unique_ptr<StartedThread> &started = started_threads[idx];
+            if(started->finished.load(std::memory_order_acquire))
+            {
+                started->os_thread.join();
+                continue;
+            }
+            started_threads[keep++] = std::move(started);
+        }
+        started_threads.resize(keep);
+    }
+
+    void ThreadScheduler::join_started_threads(ThreadState *thread)
+    {
+        while(!started_threads.empty())
+        {
+            std::vector<std::unique_ptr<StartedThread>> joining =
+                std::move(started_threads);
+            started_threads.clear();
+            {
+                ThreadState::BlockingScope blocking(thread);
+                for(const std::unique_ptr<StartedThread> &started: joining)
+                {
+                    started->os_thread.join();
+                }
+            }
+        }
+    }
+
+    bool ThreadScheduler::prepare_fork()
+    {
+        reap_finished_threads();
+        return started_threads.empty();
+    }
+
+    bool ThreadScheduler::acquire_lock_blocking(
+        ThreadState *thread, std::atomic<bool> &locked,
+        std::optional<double> timeout_seconds)
+    {
+        auto try_acquire = [&locked] {
+            bool expected = false;
+            return locked.compare_exchange_strong(expected, true,
+                                                  std::memory_order_acquire);
+        };
+
+        ThreadState::BlockingScope blocking(thread);
+        std::unique_lock<std::mutex> lock(lock_wait_mutex);
+        n_lock_waiters.fetch_add(1);
+        bool acquired;
+        if(!timeout_seconds.has_value())
+        {
+            lock_wait_cv.wait(lock, try_acquire);
+            acquired = true;
+        }
+        else
+        {
+            acquired = lock_wait_cv.wait_for(
+                lock, std::chrono::duration<double>(*timeout_seconds),
+                try_acquire);
+        }
+        n_lock_waiters.fetch_sub(1);
+        return acquired;
+    }
+
+    void ThreadScheduler::release_lock(std::atomic<bool> &locked)
+    {
+        locked.store(false);
+        if(n_lock_waiters.load() == 0)
+        {
+            return;
+        }
+        // Taking the mutex orders this wakeup after a waiter that has
+        // counted itself but not yet gone to sleep.
+        {
+            std::lock_guard<std::mutex> lock(lock_wait_mutex);
+        }
+        lock_wait_cv.notify_all();
+    }
+
+}  // namespace cl
@@ -0,0 +1,97 @@
+#ifndef CL_THREAD_SCHEDULER_H
+#define CL_THREAD_SCHEDULER_H
+
+#include "object_model/typed_value.h"
+#include "object_model/value.h"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+namespace cl
+{
+    class Function;
+    class ThreadState;
+    class Tuple;
+    class VirtualMachine;
+
+    /*
+      Runs Python-started threads on OS threads, each with its own
+      ThreadState, and arbitrates which of them is executing.
+
+      Refcounts, zero-count tables, inline caches, and shape transitions are
+      still plain single-writer state, so mutators take turns: at most one
+      ThreadState is attached to the VM at a time. A thread that wants to
+      attach waits for one switch interval, then requests a safepoint; the
+      attached thread hands the VM over in arrival order when it reaches one.
+      Blocking operations detach around the wait, so sleeping and lock
+      waiting threads do not hold up the others.
+    */
+    class ThreadScheduler
+    {
+    public:
+        // Matches the sys.getswitchinterval() default.
+        static constexpr std::chrono::microseconds kSwitchInterval{5000};
+
+        explicit ThreadScheduler(VirtualMachine *vm);
+        ~ThreadScheduler();
+
+        // Gives the VM's default thread an identifier and attaches it.
+        void register_main_thread(ThreadState *thread);
+        void attach(ThreadState *thread);
+        // Returns false when `thread` was not the attached thread.
+        bool detach(ThreadState *thread);
+        // Called at a safepoint: hands the VM to any thread waiting to
+        // attach and queues `thread` behind them.
+        void yield(ThreadState *thread);
+
+        // Starts function(*args) on a new OS thread and returns the thread
+        // identifier it will observe from get_ident().
+        [[nodiscard]] Value start_thread(TValue<Function> function,
+                                         TValue<Tuple> args);
+        // Waits, detached, for every started thread to finish.
+        void join_started_threads(ThreadState *thread);
+        // Joins started threads that have finished and returns true when no
+        // started thread is still running, so the process can fork without
+        // leaving a half-run thread behind in the child.
+        bool prepare_fork();
+
+        // Acquires `locked` from false to true. A nullopt timeout waits
+        // forever. The caller is detached while it waits.
+        bool acquire_lock_blocking(ThreadState *thread,
+                                   std::atomic<bool> &locked,
+                                   std::optional<double> timeout_seconds);
+        void release_lock(std::atomic<bool> &locked);
+
+    private:
+        struct StartedThread;
+
+        void run_started_thread(StartedThread *started);
+        void reap_finished_threads();
+        void request_safepoint_from_waiter();
+
+        VirtualMachine *vm;
+
+        std::mutex attach_mutex;
+        std::condition_variable attach_cv;
+        ThreadState *attached_thread = nullptr;
+        uint64_t next_attach_ticket = 0;
+        uint64_t serving_attach_ticket = 0;
+
+        std::mutex lock_wait_mutex;
+        std::condition_variable lock_wait_cv;
+        std::atomic<uint32_t> n_lock_waiters{0};
+
+        // Only touched by the attached thread.
+        std::vector<std::unique_ptr<StartedThread>> started_threads;
+        std::vector<ThreadState *> idle_threads;
+        int64_t next_thread_ident = 1;
+    };
+
+}  // namespace cl
+
+#endif  // CL_THREAD_SCHEDULER_H
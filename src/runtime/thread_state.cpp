@@ -2,6 +2,7 @@
 #include "api/clover_entry.h"
 #include "builtin_types/dict.h"
 #include "builtin_types/module_object.h"
+#include "builtin_types/tuple.h"
 #include "bytecode/code_object.h"
 #include "compiler/codegen.h"
 #include "compiler/compilation_unit.h"
@@ -14,8 +15,10 @@
 #include "runtime/exception_object.h"
 #include "runtime/interpreter.h"
 #include "runtime/runtime_helpers.h"
+#include "runtime/thread_scheduler.h"
 #include "runtime/virtual_machine.h"
 #include <algorithm>
+#include <atomic>
 #include <bit>
 #include <cstdint>
 #include <iterator>
@@ -35,7 +38,8 @@ namespace cl
 
     PendingException::PendingException()
         : object(Optional<TValue<Exception>>::none()),
-          stop_iteration_value(Value::not_present())
+          stop_iteration_value(Value::not_present()),
+          exception_class(Value::not_present())
     {
     }
 
@@ -77,6 +81,11 @@ namespace cl
                           machine->safepoint_requested_ptr()),
           stack(1024 * 1024)
     {
+#if CL_REFCOUNT_MODE == CL_REFCOUNT_MODE_BIASED
+        static std::atomic<uint32_t> next_refcount_owner{1};
+        refcount_owner_ =
+            next_refcount_owner.fetch_add(1, std::memory_order_relaxed);
+#endif
         assert(code_cache_ != nullptr);
         Value *sentinel_fp = compute_clover_frame_sentinel(stack);
         clover_frame_sentinel_ptr = sentinel_fp;
@@ -117,6 +126,26 @@ namespace cl
             code_object->offset_for_interpreted_pc(pc), safepoint_scan_record_);
         NoActiveThreadScope no_active_thread;
         machine->complete_safepoint();
+        machine->thread_scheduler().yield(this);
+    }
+
+    void ThreadState::begin_blocking()
+    {
+        assert(!blocking_detached_);
+        blocking_saved_scan_record_ = safepoint_scan_record_;
+        publish_safepoint_scan_record(clover_frame_frontier(),
+                                      Value::not_present());
+        blocking_detached_ = machine->thread_scheduler().detach(this);
+    }
+
+    void ThreadState::end_blocking()
+    {
+        if(blocking_detached_)
+        {
+            machine->thread_scheduler().attach(this);
+            blocking_detached_ = false;
+        }
+        safepoint_scan_record_ = blocking_saved_scan_record_;
     }
 
     static Value *entry_frame_pointer(Value *caller_fp, CodeObject *code_object)
@@ -230,6 +259,25 @@ namespace cl
         return call_clovervm_function_with_args(function, args, 7);
     }
 
+    Value
+    ThreadState::call_clovervm_function_with_tuple(TValue<Function> function,
+                                                   TValue<Tuple> args)
+    {
+        const Tuple *tuple = args.extract();
+        if(tuple->size() > MaxCloverFunctionEntryAdapterArgs)
+        {
+            return set_pending_builtin_exception_string(
+                L"TypeError", L"too many arguments for a native entry call");
+        }
+        std::array<Value, MaxCloverFunctionEntryAdapterArgs> items;
+        for(size_t idx = 0; idx < tuple->size(); ++idx)
+        {
+            items[idx] = tuple->item_unchecked(idx);
+        }
+        return call_clovervm_function_with_args(function, items.data(),
+                                                uint32_t(tuple->size()));
+    }
+
     Expected<TValue<SMI>> ThreadState::hash_value(Value value)
     {
         Value result = call_clovervm_function(
@@ -368,10 +416,70 @@ namespace cl
     {
         pending_exception.object = Optional<TValue<Exception>>::none();
         pending_exception.stop_iteration_value = value;
+        pending_exception.exception_class = Value::not_present();
+        pending_exception.traceback.clear();
         pending_exception.kind = PendingExceptionKind::StopIteration;
         return Value::exception_marker();
     }
 
+    ClassObject *ThreadState::pending_exception_class() const
+    {
+        assert(pending_exception.kind == PendingExceptionKind::Class);
+        return pending_exception.exception_class.value().get_ptr<ClassObject>();
+    }
+
+    TValue<Exception> ThreadState::materialize_pending_exception_object()
+    {
+        if(pending_exception.kind == PendingExceptionKind::Object)
+        {
+            return pending_exception_object();
+        }
+
+        TValue<Exception> exception =
+            pending_exception.kind == PendingExceptionKind::StopIteration
+                ? TValue<Exception>::from_value_unchecked(
+                      make_stop_iteration_object(
+                          this,
+                          TValue<ClassObject>::from_oop(
+                              class_for_native_layout(
+                                  NativeLayoutId::StopIteration)),
+                          pending_stop_iteration_value())
+                          .raw_value())
+                : make_exception_object(
+                      this,
+                      TValue<ClassObject>::from_oop(pending_exception_class()),
+                      L"");
+        pending_exception.object = Optional<TValue<Exception>>::some(exception);
+        pending_exception.stop_iteration_value = Value::not_present();
+        pending_exception.exception_class = Value::not_present();
+        pending_exception.kind = PendingExceptionKind::Object;
+        return exception;
+    }
+
+    TValue<Exception> ThreadState::observe_pending_exception_object()
+    {
+        TValue<Exception> exception = materialize_pending_exception_object();
+        if(pending_exception.traceback.empty())
+        {
+            return exception;
+        }
+
+        TValue<String> traceback_name =
+            machine->get_or_create_interned_string_value(L"__traceback__");
+        Value existing = exception.extract()->get_own_property(traceback_name);
+        if(existing.is_not_present())
+        {
+            existing = Value::None();
+        }
+        Value traceback =
+            materialize_traceback(this, pending_exception.traceback, existing);
+        [[maybe_unused]] bool ok =
+            exception.extract()->set_own_property(traceback_name, traceback);
+        assert(ok);
+        pending_exception.traceback.clear();
+        return exception;
+    }
+
     Shape *ThreadState::shape_of_inline_value(Value value) const
     {
         return machine->shape_for_inline_value(value);
@@ -420,6 +528,8 @@ namespace cl
     Expected<CodeObject *> ThreadState::compile(const wchar_t *str,
                                                 StartRule start_rule)
     {
+        ActivationScope activation_scope(this);
+
         ModuleObject *module = make_main_module(Value::not_present());
         return compile_in_module(str, start_rule, module,
                                  LanguageMode::StandardsCompliant);
@@ -478,11 +588,28 @@ namespace cl
         }
 
         assert(obj->lifecycle_state == HeapLifecycleState::Normal);
-        assert(obj->refcount == 0);
+        assert(heap_object_refcount(obj) == 0);
         obj->lifecycle_state = HeapLifecycleState::InZct;
         zero_count_table.push_back(obj);
     }
 
+    void ThreadState::remember_old_object(HeapObject *obj)
+    {
+        assert(obj->generation == HeapGeneration::Old);
+        obj->generation = HeapGeneration::OldRemembered;
+        remembered_set.push_back(obj);
+    }
+
+    void ThreadState::clear_remembered_set()
+    {
+        for(HeapObject *obj: remembered_set)
+        {
+            assert(obj->generation == HeapGeneration::OldRemembered);
+            obj->generation = HeapGeneration::Old;
+        }
+        remembered_set.clear();
+    }
+
     void ThreadState::adopt_reclamation_state_from(ThreadState &child)
     {
         assert(this != &child);
@@ -500,6 +627,10 @@ namespace cl
             std::make_move_iterator(child.zero_count_table.begin()),
             std::make_move_iterator(child.zero_count_table.end()));
         child.zero_count_table.clear();
+        remembered_set.insert(remembered_set.end(),
+                              child.remembered_set.begin(),
+                              child.remembered_set.end());
+        child.remembered_set.clear();
         refcounted_heap.adopt_epoch_state_from(child.refcounted_heap);
     }
 
@@ -510,4 +641,11 @@ namespace cl
                          obj) != zero_count_table.end();
     }
 
+    bool
+    ThreadState::remembered_set_contains_for_testing(HeapObject *obj) const
+    {
+        return std::find(remembered_set.begin(), remembered_set.end(), obj) !=
+               remembered_set.end();
+    }
+
 }  // namespace cl
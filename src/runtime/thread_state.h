@@ -12,6 +12,7 @@
 #include "object_model/typed_value.h"
 #include "object_model/value.h"
 #include "runtime/exception_object.h"
+#include "runtime/traceback.h"
 #include <type_traits>
 #include <utility>
 
@@ -31,6 +32,7 @@ namespace cl
     class Function;
     class ModuleObject;
     class Scope;
+    class Tuple;
     class VirtualMachine;
     class CodeObject;
     class ThreadState;
@@ -49,6 +51,10 @@ namespace cl
         None,
         Object,
         StopIteration,
+        // `raise SomeClass` whose instance nothing has observed yet. Only
+        // interpreter frames see this kind; the native return boundary
+        // materializes it into an Object.
+        Class,
     };
 
     struct PendingException
@@ -56,6 +62,8 @@ namespace cl
         PendingExceptionKind kind = PendingExceptionKind::None;
         Member<Optional<TValue<Exception>>> object;
         Member<Value> stop_iteration_value;
+        Member<Value> exception_class;
+        TracebackRing traceback;
 
         PendingException();
     };
@@ -75,12 +83,12 @@ namespace cl
             explicit ActivationScope(ThreadState *ts)
                 : previous_thread(ThreadState::current_thread)
             {
-                ThreadState::current_thread = ts;
+                ThreadState::set_current_thread(ts);
             }
 
             ~ActivationScope()
             {
-                ThreadState::current_thread = previous_thread;
+                ThreadState::set_current_thread(previous_thread);
             }
 
         private:
@@ -92,18 +100,36 @@ namespace cl
         public:
             NoActiveThreadScope() : previous_thread(ThreadState::current_thread)
             {
-                ThreadState::current_thread = nullptr;
+                ThreadState::set_current_thread(nullptr);
             }
 
             ~NoActiveThreadScope()
             {
-                ThreadState::current_thread = previous_thread;
+                ThreadState::set_current_thread(previous_thread);
             }
 
         private:
             ThreadState *previous_thread;
         };
 
+        // Releases the VM to other mutator threads around a blocking native
+        // wait. The thread's native frame frontier is published as its scan
+        // record first, so a reclamation run by another thread still sees
+        // its frames. Code inside the scope must not touch heap values.
+        class BlockingScope
+        {
+        public:
+            explicit BlockingScope(ThreadState *ts) : thread(ts)
+            {
+                thread->begin_blocking();
+            }
+
+            ~BlockingScope() { thread->end_blocking(); }
+
+        private:
+            ThreadState *thread;
+        };
+
         ThreadState(VirtualMachine *_machine);
 
         void refresh_class_for_native_layout_cache();
@@ -121,6 +147,15 @@ namespace cl
         void add_to_zero_count_table_if_needed(HeapObject *obj);
         void adopt_reclamation_state_from(ThreadState &child);
         size_t zero_count_table_size() const { return zero_count_table.size(); }
+        size_t recycled_cell_count() const
+        {
+            return refcounted_heap.recycled_cell_count();
+        }
+        // Records an Old object that was given a reference to a Young one.
+        void remember_old_object(HeapObject *obj);
+        void clear_remembered_set();
+        size_t remembered_set_size() const { return remembered_set.size(); }
+        bool remembered_set_contains_for_testing(HeapObject *obj) const;
         bool zero_count_table_contains_for_testing(HeapObject *obj) const;
         void switch_to_new_heap_slabs()
         {
@@ -169,6 +204,11 @@ namespace cl
                                                    Value arg2, Value arg3,
                                                    Value arg4, Value arg5,
                                                    Value arg6);
+        // Calls function(*args); args may hold at most
+        // MaxCloverFunctionEntryAdapterArgs items.
+        [[nodiscard]] Value
+        call_clovervm_function_with_tuple(TValue<Function> function,
+                                          TValue<Tuple> args);
         [[nodiscard]] Expected<TValue<SMI>> hash_value(Value value);
         [[nodiscard]] Expected<bool> test_equal(Value left, Value right);
         [[nodiscard]] Value call_clovervm_method(Value receiver,
@@ -201,7 +241,8 @@ namespace cl
         }
         ALWAYSINLINE bool safepoint_requested() const
         {
-            return *safepoint_requested_ptr;
+            // Threads waiting to attach set the flag from other OS threads.
+            return __atomic_load_n(safepoint_requested_ptr, __ATOMIC_RELAXED);
         }
         void publish_safepoint_scan_record(Value *lowest_live_stack_slot,
                                            Value accumulator_or_not_present);
@@ -211,6 +252,9 @@ namespace cl
         {
             return safepoint_scan_record_;
         }
+        void begin_blocking();
+        void end_blocking();
+        int64_t thread_ident() const { return thread_ident_; }
 
         bool has_pending_exception() const
         {
@@ -225,6 +269,8 @@ namespace cl
             pending_exception.kind = PendingExceptionKind::None;
             pending_exception.object = Optional<TValue<Exception>>::none();
             pending_exception.stop_iteration_value = Value::not_present();
+            pending_exception.exception_class = Value::not_present();
+            pending_exception.traceback.clear();
         }
         [[nodiscard]] Value
         set_pending_exception_object(TValue<Exception> exception)
@@ -232,10 +278,22 @@ namespace cl
             pending_exception.object =
                 Optional<TValue<Exception>>::some(exception);
             pending_exception.stop_iteration_value = Value::not_present();
+            pending_exception.exception_class = Value::not_present();
+            pending_exception.traceback.clear();
             pending_exception.kind = PendingExceptionKind::Object;
             return Value::exception_marker();
         }
         [[nodiscard]] Value
+        set_pending_exception_class(TValue<ClassObject> type)
+        {
+            pending_exception.object = Optional<TValue<Exception>>::none();
+            pending_exception.stop_iteration_value = Value::not_present();
+            pending_exception.exception_class = type.raw_value();
+            pending_exception.traceback.clear();
+            pending_exception.kind = PendingExceptionKind::Class;
+            return Value::exception_marker();
+        }
+        [[nodiscard]] Value
         set_pending_exception_string(TValue<ClassObject> type,
                                      TValue<String> message);
         [[nodiscard]] Value
@@ -255,6 +313,8 @@ namespace cl
         {
             pending_exception.object = Optional<TValue<Exception>>::none();
             pending_exception.stop_iteration_value = Value::not_present();
+            pending_exception.exception_class = Value::not_present();
+            pending_exception.traceback.clear();
             pending_exception.kind = PendingExceptionKind::StopIteration;
             return Value::exception_marker();
         }
@@ -270,6 +330,24 @@ namespace cl
                    PendingExceptionKind::StopIteration);
             return pending_exception.stop_iteration_value.value();
         }
+        ClassObject *pending_exception_class() const;
+        // Replaces a compact StopIteration or Class pending exception with an
+        // exception object, keeping the lazy traceback records.
+        TValue<Exception> materialize_pending_exception_object();
+        // Materializes the pending exception object for Python code that is
+        // about to bind it, and moves the lazy traceback records into its
+        // __traceback__ chain.
+        TValue<Exception> observe_pending_exception_object();
+        ALWAYSINLINE void
+        record_pending_traceback_entry(CodeObject *code_object,
+                                       uint32_t pc_offset)
+        {
+            pending_exception.traceback.record(code_object, pc_offset);
+        }
+        const TracebackRing &pending_traceback() const
+        {
+            return pending_exception.traceback;
+        }
 
         static ThreadState *get_active()
         {
@@ -369,6 +447,25 @@ namespace cl
                 initial_shape, std::forward<Args>(args)...));
         }
 
+        // Builds a T in a cell freed by the last reclamation, or returns
+        // nullptr when none is left. The cell is outside the epoch slabs, so
+        // the object starts in the zero-count table, where the next
+        // reclamation finds it if it is still unreferenced.
+        template <typename T, typename... Args>
+        T *make_object_raw_in_recycled_cell(Args &&...args)
+        {
+            static_assert(std::is_base_of_v<Object, T>);
+            T *obj = refcounted_heap.make_in_recycled_cell<T>(
+                class_for_native_layout(T::native_layout),
+                std::forward<Args>(args)...);
+            if(obj != nullptr)
+            {
+                obj->lifecycle_state = HeapLifecycleState::InZct;
+                zero_count_table.push_back(obj);
+            }
+            return obj;
+        }
+
         Expected<CodeObject *> compile(const wchar_t *str,
                                        StartRule start_rule);
         Expected<CodeObject *> compile(const wchar_t *str, StartRule start_rule,
@@ -408,6 +505,7 @@ namespace cl
                                                            uint32_t n_args);
         NOINLINE Shape *shape_of_inline_value(Value value) const;
 
+        friend class ThreadScheduler;
         friend void
         process_thread_reclamation_epoch(ThreadState &thread,
                                          const ReclamationRootSet &roots);
@@ -431,8 +529,12 @@ namespace cl
 
         std::vector<Value> stack;
         std::vector<HeapObject *> zero_count_table;
+        std::vector<HeapObject *> remembered_set;
         PendingException pending_exception;
         SafepointScanRecord safepoint_scan_record_;
+        SafepointScanRecord blocking_saved_scan_record_;
+        bool blocking_detached_ = false;
+        int64_t thread_ident_ = 0;
         bool trace_interpreter_instructions_ = false;
         Value *trace_interpreter_frame_ptr_ = nullptr;
         // This thread's Clover frame frontier during native execution: the
@@ -443,6 +545,20 @@ namespace cl
         // Permanent root frame for this thread's Clover frame chain.
         Value *clover_frame_sentinel_ptr = nullptr;
 
+        static void set_current_thread(ThreadState *ts)
+        {
+            current_thread = ts;
+#if CL_REFCOUNT_MODE == CL_REFCOUNT_MODE_BIASED
+            active_refcount_owner = ts != nullptr ? ts->refcount_owner_ : 0;
+#endif
+        }
+
+#if CL_REFCOUNT_MODE == CL_REFCOUNT_MODE_BIASED
+        // Owner id stamped into objects this thread allocates. Never reused,
+        // so objects of a finished thread stay on the shared path.
+        uint32_t refcount_owner_;
+#endif
+
         static thread_local ThreadState *current_thread;
     };
 
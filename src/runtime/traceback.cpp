@@ -0,0 +1,60 @@
+#include "runtime/traceback.h"
+
+#include "bytecode/code_object.h"
+#include "object_model/class_object.h"
+#include "object_model/shape.h"
+#include "runtime/thread_state.h"
+#include "runtime/virtual_machine.h"
+
+namespace cl
+{
+    static constexpr DescriptorFlags traceback_slot_flags()
+    {
+        return descriptor_flag(DescriptorFlag::StableSlot) |
+               descriptor_flag(DescriptorFlag::ReadOnly);
+    }
+
+    static void install_traceback_instance_root_shape(VirtualMachine *vm,
+                                                      ClassObject *cls)
+    {
+        BuiltinInstanceShapeBuilder(cls, BuiltinInstanceShapeDefaults::None,
+                                    TracebackObject::kInlineSlotCount)
+            .add_slot(vm->get_or_create_interned_string_value(L"tb_next"),
+                      TracebackObject::kNextSlot, traceback_slot_flags())
+            .add_slot(vm->get_or_create_interned_string_value(L"tb_code"),
+                      TracebackObject::kCodeSlot, traceback_slot_flags())
+            .add_slot(vm->get_or_create_interned_string_value(L"tb_lasti"),
+                      TracebackObject::kLastiSlot, traceback_slot_flags())
+            .install(immutable_shape_flags());
+    }
+
+    BuiltinClassDefinition make_traceback_class(VirtualMachine *vm)
+    {
+        static constexpr NativeLayoutId native_layout_ids[] = {
+            NativeLayoutId::Traceback};
+        ClassObject *cls = ClassObject::make_builtin_class<TracebackObject>(
+            vm->get_or_create_interned_string_value(L"traceback"),
+            TracebackObject::kInlineSlotCount, nullptr, 0, vm->object_class(),
+            immutable_shape_flags());
+        install_traceback_instance_root_shape(vm, cls);
+        return builtin_class_definition(cls, native_layout_ids,
+                                        BuiltinsVisibility::Internal);
+    }
+
+    Value materialize_traceback(ThreadState *thread, const TracebackRing &ring,
+                                Value existing)
+    {
+        Value next = existing;
+        for(uint32_t idx = 0; idx < ring.size(); ++idx)
+        {
+            const TracebackEntry &entry = ring.entry(idx);
+            next = thread
+                       ->make_object_value<TracebackObject>(
+                           next, Value::from_oop(entry.code_object),
+                           Value::from_smi(int64_t(entry.pc_offset)))
+                       .raw_value();
+        }
+        return next;
+    }
+
+}  // namespace cl
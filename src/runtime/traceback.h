@@ -0,0 +1,123 @@
+#ifndef CL_TRACEBACK_H
+#define CL_TRACEBACK_H
+
+#include "object_model/builtin_class_registry.h"
+#include "object_model/object.h"
+#include "object_model/owned.h"
+#include "object_model/typed_value.h"
+#include "object_model/value.h"
+#include "util/compiler.h"
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <type_traits>
+
+namespace cl
+{
+    class ClassObject;
+    class CodeObject;
+    class ThreadState;
+    class VirtualMachine;
+
+    struct TracebackEntry
+    {
+        CodeObject *code_object;
+        uint32_t pc_offset;
+    };
+
+    // Lazy traceback state for the pending exception: one (code object, pc)
+    // record per frame the exceptional path has visited, innermost first.
+    // Recording is a store and an increment; heap traceback objects are only
+    // built when the exception is observed. The first kHeadCapacity records
+    // are kept; later records wrap around the remaining slots, so a very deep
+    // unwind keeps its raise site and its outermost frames and drops the
+    // middle.
+    class TracebackRing
+    {
+    public:
+        static constexpr uint32_t kCapacity = 64;
+        static constexpr uint32_t kHeadCapacity = 16;
+        static constexpr uint32_t kTailCapacity = kCapacity - kHeadCapacity;
+
+        void clear() { n_recorded = 0; }
+        bool empty() const { return n_recorded == 0; }
+
+        ALWAYSINLINE void record(CodeObject *code_object, uint32_t pc_offset)
+        {
+            uint32_t slot =
+                n_recorded < kCapacity
+                    ? n_recorded
+                    : kHeadCapacity +
+                          (n_recorded - kHeadCapacity) % kTailCapacity;
+            entries[slot] = TracebackEntry{code_object, pc_offset};
+            ++n_recorded;
+        }
+
+        uint32_t size() const { return std::min(n_recorded, kCapacity); }
+        uint32_t n_dropped() const { return n_recorded - size(); }
+
+        // Retained records in unwind order, innermost first.
+        const TracebackEntry &entry(uint32_t idx) const
+        {
+            assert(idx < size());
+            if(n_recorded <= kCapacity || idx < kHeadCapacity)
+            {
+                return entries[idx];
+            }
+            uint32_t record_idx =
+                n_recorded - kTailCapacity + (idx - kHeadCapacity);
+            return entries[kHeadCapacity +
+                           (record_idx - kHeadCapacity) % kTailCapacity];
+        }
+
+    private:
+        std::array<TracebackEntry, kCapacity> entries;
+        uint32_t n_recorded = 0;
+    };
+
+    class TracebackObject : public SlotObject
+    {
+    public:
+        static constexpr NativeLayoutId native_layout =
+            NativeLayoutId::Traceback;
+        static constexpr uint32_t kNextSlot = 0;
+        static constexpr uint32_t kCodeSlot = 1;
+        static constexpr uint32_t kLastiSlot = 2;
+        static constexpr uint32_t kInlineSlotCount = 3;
+
+        TracebackObject(ClassObject *cls, Value next, Value code, Value lasti)
+            : SlotObject(cls, native_layout), tb_next(next), tb_code(code),
+              tb_lasti(lasti)
+        {
+        }
+
+        Member<Value> tb_next;
+        Member<Value> tb_code;
+        Member<Value> tb_lasti;
+
+        CL_DECLARE_STATIC_VALUE_SPAN_EXTENDS(TracebackObject, SlotObject, 3);
+        CL_DECLARE_STATIC_OBJECT_SIZE(TracebackObject);
+    };
+
+    static_assert(CL_OFFSETOF(TracebackObject, tb_next) ==
+                  sizeof(SlotObject) +
+                      TracebackObject::kNextSlot * sizeof(Value));
+    static_assert(CL_OFFSETOF(TracebackObject, tb_code) ==
+                  sizeof(SlotObject) +
+                      TracebackObject::kCodeSlot * sizeof(Value));
+    static_assert(CL_OFFSETOF(TracebackObject, tb_lasti) ==
+                  sizeof(SlotObject) +
+                      TracebackObject::kLastiSlot * sizeof(Value));
+    static_assert(std::is_trivially_destructible_v<TracebackObject>);
+
+    BuiltinClassDefinition make_traceback_class(VirtualMachine *vm);
+
+    // Builds heap traceback objects for the retained ring records, outermost
+    // frame first, and links the innermost one to `existing` so a re-raised
+    // exception keeps the chain it already carried.
+    Value materialize_traceback(ThreadState *thread, const TracebackRing &ring,
+                                Value existing);
+
+}  // namespace cl
+
+#endif  // CL_TRACEBACK_H
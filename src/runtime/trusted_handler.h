@@ -70,6 +70,10 @@ namespace cl
         GreaterEqual,
         Neg,
         Pos,
+        Abs,
+        Length,
+        Min,
+        Max,
     };
 
     struct TrustedHandlerMetadata
@@ -40,7 +40,10 @@
 #include "runtime/exception_propagation.h"
 #include "runtime/fatal.h"
 #include "runtime/protocol_helper_functions.h"
+#include "runtime/thread_module.h"
+#include "runtime/thread_scheduler.h"
 #include "runtime/thread_state.h"
+#include "runtime/traceback.h"
 #include <bit>
 #include <cassert>
 #include <cstdint>
@@ -218,8 +221,9 @@ namespace cl
                              make_string_list(vm, {L""}));
         install_module_value(vm, sys_module, L"warnoptions",
                              make_string_list(vm, {}));
-        install_module_value(vm, sys_module, L"builtin_module_names",
-                             make_string_tuple(vm, {L"builtins", L"sys"}));
+        install_module_value(
+            vm, sys_module, L"builtin_module_names",
+            make_string_tuple(vm, {L"builtins", L"sys", L"_thread"}));
         install_module_value(vm, sys_module, L"byteorder",
                              make_string_value(vm, sys_byteorder_name()));
         install_module_value(vm, sys_module, L"copyright",
@@ -247,6 +251,56 @@ namespace cl
                              make_version_info(vm));
     }
 
+    // Smallest nonzero limit sys.set_int_max_str_digits accepts, matching
+    // CPython's sys.int_info.str_digits_check_threshold.
+    static constexpr int64_t int_max_str_digits_threshold = 640;
+
+    static Value sys_get_int_max_str_digits(ThreadState *thread)
+    {
+        return Value::from_smi(thread->get_machine()->int_max_str_digits());
+    }
+
+    static Value sys_set_int_max_str_digits(ThreadState *thread,
+                                            Value max_digits)
+    {
+        if(!max_digits.is_smi())
+        {
+            return thread->set_pending_builtin_exception_string(
+                L"TypeError",
+                L"set_int_max_str_digits() argument must be an int");
+        }
+        int64_t limit = max_digits.get_smi();
+        if(limit != 0 && limit < int_max_str_digits_threshold)
+        {
+            return thread->set_pending_builtin_exception_string(
+                L"ValueError", L"maxdigits must be >= 640 or 0 for unlimited");
+        }
+        thread->get_machine()->set_int_max_str_digits(limit);
+        return Value::None();
+    }
+
+    static void install_sys_native_functions(VirtualMachine *vm,
+                                             ModuleObject *sys_module)
+    {
+        BuiltinIntrinsicMethod functions[] = {
+            builtin_intrinsic_method(
+                L"get_int_max_str_digits", sys_get_int_max_str_digits,
+                L"Return the maximum digits for int/str conversion."),
+            builtin_intrinsic_method(
+                L"set_int_max_str_digits", sys_set_int_max_str_digits,
+                L"Set the maximum digits for int/str conversion."),
+        };
+        for(const BuiltinIntrinsicMethod &function: functions)
+        {
+            install_module_value(
+                vm, sys_module, function.name,
+                unwrap_bootstrap_expected(
+                    vm, make_intrinsic_function(vm, function),
+                    "creating sys function")
+                    .raw_value());
+        }
+    }
+
     [[nodiscard]] static Value require_range_integer_arg(Value arg,
                                                          Value &arg_out)
     {
@@ -476,7 +530,8 @@ namespace cl
               Optional<TValue<Function>>::none()),
           membership_sequence_fallback_function_(
               Optional<TValue<Function>>::none()),
-          native_library_handles_(std::make_unique<NativeLibraryHandleCache>())
+          native_library_handles_(std::make_unique<NativeLibraryHandleCache>()),
+          thread_scheduler_(std::make_unique<ThreadScheduler>(this))
     {
         struct BootstrapCleanup
         {
@@ -505,6 +560,7 @@ namespace cl
 
         // make the main thread
         ThreadState *default_thread = make_new_thread();
+        thread_scheduler_->register_main_thread(default_thread);
         ThreadState::ActivationScope activation_scope(default_thread);
         initialize_builtins();
         default_thread->switch_to_new_heap_slabs();
@@ -516,6 +572,7 @@ namespace cl
         if(!threads.empty())
         {
             ThreadState::ActivationScope activation_scope(threads[0].get());
+            thread_scheduler_->join_started_threads(threads[0].get());
             range_builtin = Value::None();
             hash_value_helper_function_ = Optional<TValue<Function>>::none();
             test_equal_helper_function_ = Optional<TValue<Function>>::none();
@@ -534,6 +591,11 @@ namespace cl
         return *native_library_handles_;
     }
 
+    ThreadScheduler &VirtualMachine::thread_scheduler()
+    {
+        return *thread_scheduler_;
+    }
+
     jit::CodeCache *VirtualMachine::make_code_cache()
     {
         auto code_cache = std::make_unique<jit::CodeCache>();
@@ -549,9 +611,75 @@ namespace cl
 
     void VirtualMachine::run_heap_reclamation()
     {
+#if CL_REFCOUNT_MODE == CL_REFCOUNT_MODE_BIASED
+        merge_queued_shared_refcounts();
+        reclamation_in_progress_ = true;
         cl::run_heap_reclamation(threads);
+        reclamation_in_progress_ = false;
+#else
+        cl::run_heap_reclamation(threads);
+#endif
     }
 
+    bool VirtualMachine::prepare_for_fork()
+    {
+        ThreadState::ActivationScope activation_scope(get_default_thread());
+        if(!thread_scheduler_->prepare_fork())
+        {
+            return false;
+        }
+        run_heap_reclamation();
+        return true;
+    }
+
+#if CL_REFCOUNT_MODE == CL_REFCOUNT_MODE_BIASED
+    /*
+      Reclamation runs while the reclaiming thread holds the VM attach, so no
+      owner is updating its plain count and any thread may fold the shared
+      count in. Releases made during reclamation itself fold immediately,
+      because an object queued then could be reclaimed before the next merge.
+    */
+    static bool fold_shared_refcount(HeapObject *obj)
+    {
+        obj->refcount += std::atomic_ref<int32_t>(obj->shared_refcount)
+                             .exchange(0, std::memory_order_acq_rel);
+        return obj->refcount == 0;
+    }
+
+    void VirtualMachine::queue_shared_refcount_merge(HeapObject *obj)
+    {
+        if(reclamation_in_progress_)
+        {
+            if(fold_shared_refcount(obj))
+            {
+                ThreadState::add_to_active_zero_count_table_if_needed(obj);
+            }
+            return;
+        }
+        std::lock_guard<std::mutex> lock(shared_refcount_merge_mutex_);
+        shared_refcount_merge_queue_.push_back(obj);
+    }
+
+    void VirtualMachine::merge_queued_shared_refcounts()
+    {
+        // An object can be queued more than once; later merges see a zero
+        // shared count and only recheck the owner count.
+        std::vector<HeapObject *> queue;
+        {
+            std::lock_guard<std::mutex> lock(shared_refcount_merge_mutex_);
+            queue.swap(shared_refcount_merge_queue_);
+        }
+        ThreadState *thread = get_default_thread();
+        for(HeapObject *obj: queue)
+        {
+            if(fold_shared_refcount(obj))
+            {
+                thread->add_to_zero_count_table_if_needed(obj);
+            }
+        }
+    }
+#endif
+
     void VirtualMachine::complete_safepoint()
     {
         run_heap_reclamation();
@@ -1064,6 +1192,17 @@ namespace cl
         register_builtin_class(make_slotdict_class(this));
         register_builtin_class(make_slice_class(this));
         register_builtin_class(make_float_class(this));
+        if constexpr(value_immediate_floats)
+        {
+            immediate_float_shape_ =
+                Shape::make_immortal_root_with_single_descriptor(
+                    this, TValue<ClassObject>::from_oop(float_class()),
+                    dunder_class_name(),
+                    DescriptorInfo::make(StorageLocation::not_found(),
+                                         inline_class_flags,
+                                         DescriptorSpecialKind::ShapeClass),
+                    0, 0, immutable_shape_flags());
+        }
         register_builtin_class(make_module_class(this));
         register_builtin_class(make_module_loader_class(this));
         register_builtin_class(make_module_spec_class(this));
@@ -1077,6 +1216,8 @@ namespace cl
         global_builtins_module_ = builtins_module;
         register_builtin_class(make_function_class(this));
         register_builtin_class(make_code_object_class(this));
+        register_builtin_class(make_traceback_class(this));
+        register_builtin_class(make_thread_lock_class(this));
         register_builtin_class(make_range_iterator_class(this));
         register_builtin_class(make_tuple_iterator_class(this));
         register_builtin_class(make_list_iterator_class(this));
@@ -1147,6 +1288,7 @@ namespace cl
         install_slice_class_methods(this);
         install_float_class_methods(this);
         install_module_class_methods(this);
+        install_thread_lock_class_methods(this);
 
         return builtin_classes;
     }
@@ -1222,6 +1364,7 @@ namespace cl
         (void)installed_path;
 
         install_sys_static_attributes(this, sys_module_);
+        install_sys_native_functions(this, sys_module_);
 
         unwrap_bootstrap_expected(
             this,
@@ -1233,6 +1376,7 @@ namespace cl
                                       get_default_thread(), builtins_name,
                                       builtins_module.raw_value()),
                                   "installing builtins module");
+        install_thread_module(this);
     }
 
     void VirtualMachine::initialize_builtins()
@@ -1335,6 +1479,7 @@ namespace cl
         }
 
         install_dict_python_methods(this);
+        install_builtin_function_specializations(this);
 
         TValue<String> membership_iter_fallback_name =
             get_or_create_interned_string_value(
@@ -2,6 +2,7 @@
 #define CL_VIRTUAL_MACHINE_H
 
 #include <array>
+#include <atomic>
 #include <cassert>
 #include <cstddef>
 #include <cstdint>
@@ -40,6 +41,7 @@ namespace cl
     class Function;
     class List;
     struct NativeLibraryHandleCache;
+    class ThreadScheduler;
     struct SafepointScanRecord;
 
     using SafepointCallbackForTesting =
@@ -57,6 +59,14 @@ namespace cl
 
         ThreadState *make_new_thread();
         void run_heap_reclamation();
+        // Reclaims dead objects so a forked child starts from a compact warm
+        // heap. Returns false while Python-started threads are still running.
+        bool prepare_for_fork();
+#if CL_REFCOUNT_MODE == CL_REFCOUNT_MODE_BIASED
+        // Called by a non-owner decrement that left the shared count at or
+        // below zero. The next reclamation folds it into the owner count.
+        void queue_shared_refcount_merge(HeapObject *obj);
+#endif
 
         template <TrustedHandlerFunction Target>
         void register_trusted_handler(Target target,
@@ -84,6 +94,16 @@ namespace cl
         {
             return fire_every_safepoint_for_testing_;
         }
+        // Digit limit for int/str conversion set by sys.set_int_max_str_digits;
+        // 0 disables the check.
+        int64_t int_max_str_digits() const
+        {
+            return int_max_str_digits_.load(std::memory_order_relaxed);
+        }
+        void set_int_max_str_digits(int64_t max_digits)
+        {
+            int_max_str_digits_.store(max_digits, std::memory_order_relaxed);
+        }
         void
         set_safepoint_callback_for_testing(SafepointCallbackForTesting callback,
                                            void *context)
@@ -136,6 +156,7 @@ namespace cl
         TValue<ModuleObject> sys_module() const;
         TValue<Dict> imported_modules() const;
         NativeLibraryHandleCache &native_library_handle_cache();
+        ThreadScheduler &thread_scheduler();
         void set_global_builtins_module(ModuleObject *module)
         {
             assert(module != nullptr);
@@ -251,6 +272,7 @@ namespace cl
         Shape *none_shape() const { return none_shape_; }
         Shape *not_implemented_shape() const { return not_implemented_shape_; }
         Shape *ellipsis_shape() const { return ellipsis_shape_; }
+        Shape *immediate_float_shape() const { return immediate_float_shape_; }
         ALWAYSINLINE Shape *shape_for_inline_value(Value value) const
         {
             value.assert_not_vm_sentinel();
@@ -274,6 +296,10 @@ namespace cl
             {
                 return ellipsis_shape_;
             }
+            if(value.is_immediate_float())
+            {
+                return immediate_float_shape_;
+            }
             __builtin_unreachable();
         }
         ALWAYSINLINE Shape *shape_for_key(ShapeKey key) const
@@ -296,6 +322,9 @@ namespace cl
                     return not_implemented_shape_;
                 case(value_ellipsis & value_tag_mask):
                     return ellipsis_shape_;
+                case value_immediate_float_tag:
+                    assert(value_immediate_floats);
+                    return immediate_float_shape_;
                 default:
                     __builtin_unreachable();
             }
@@ -403,6 +432,9 @@ namespace cl
             }
         }
         void complete_safepoint();
+#if CL_REFCOUNT_MODE == CL_REFCOUNT_MODE_BIASED
+        void merge_queued_shared_refcounts();
+#endif
 
         void install_native_layout_mappings(
             const BuiltinClassDefinition &definition);
@@ -443,6 +475,7 @@ namespace cl
         Shape *none_shape_ = nullptr;
         Shape *not_implemented_shape_ = nullptr;
         Shape *ellipsis_shape_ = nullptr;
+        Shape *immediate_float_shape_ = nullptr;
         Shape *str_instance_root_shape_ = nullptr;
         Shape *exact_dict_string_key_shape_ = nullptr;
         Shape *exact_dict_general_shape_ = nullptr;
@@ -462,6 +495,13 @@ namespace cl
         ModuleObject *sys_module_ = nullptr;
         Dict *imported_modules_ = nullptr;
         std::unique_ptr<NativeLibraryHandleCache> native_library_handles_;
+        std::unique_ptr<ThreadScheduler> thread_scheduler_;
+#if CL_REFCOUNT_MODE == CL_REFCOUNT_MODE_BIASED
+        std::mutex shared_refcount_merge_mutex_;
+        std::vector<HeapObject *> shared_refcount_merge_queue_;
+        bool reclamation_in_progress_ = false;
+#endif
+        std::atomic<int64_t> int_max_str_digits_ = 0;
         bool safepoint_requested_ = false;
         bool fire_every_safepoint_for_testing_ = false;
         SafepointCallbackForTesting safepoint_callback_for_testing_ = nullptr;
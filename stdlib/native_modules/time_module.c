@@ -229,13 +229,21 @@ static clover_handle time_sleep(clover_context *ctx, clover_handle seconds)
         remaining.tv_sec += 1;
         remaining.tv_nsec -= 1000000000L;
     }
+    clover_begin_blocking(ctx);
+    int sleep_errno = 0;
     while(nanosleep(&remaining, &remaining) != 0)
     {
         if(errno != EINTR)
         {
-            return clover_raise_value_error(ctx, "sleep failed");
+            sleep_errno = errno;
+            break;
         }
     }
+    clover_end_blocking(ctx);
+    if(sleep_errno != 0)
+    {
+        return clover_raise_value_error(ctx, "sleep failed");
+    }
     return clover_none(ctx);
 }
 
@@ -0,0 +1,148 @@
+"""Thread objects and locks on top of the builtin _thread module.
+
+This is a small CloverVM-supported subset. Threads take turns executing
+Python code; see doc/python-deviations.md. Condition variables, events,
+semaphores, timers, and thread-local data are omitted for now.
+"""
+
+import _thread
+
+
+get_ident = _thread.get_ident
+Lock = _thread.allocate_lock
+TIMEOUT_MAX = _thread.TIMEOUT_MAX
+
+_active_lock = _thread.allocate_lock()
+_active = {}
+_counter = 0
+
+
+def _new_thread_name():
+    global _counter
+    _counter += 1
+    return "Thread-" + str(_counter)
+
+
+class RLock:
+    def __init__(self):
+        self._block = _thread.allocate_lock()
+        self._owner = None
+        self._count = 0
+
+    def acquire(self, blocking=True, timeout=-1):
+        me = get_ident()
+        if self._owner == me:
+            self._count += 1
+            return True
+        if not self._block.acquire(blocking, timeout):
+            return False
+        self._owner = me
+        self._count = 1
+        return True
+
+    def release(self):
+        if self._owner != get_ident():
+            raise RuntimeError
+        self._count -= 1
+        if self._count == 0:
+            self._owner = None
+            self._block.release()
+
+    def __enter__(self):
+        return self.acquire()
+
+    def __exit__(self, exc_type, exc_value, traceback):
+        self.release()
+        return False
+
+
+def _bootstrap(thread):
+    thread.ident = get_ident()
+    with _active_lock:
+        _active[thread.ident] = thread
+    try:
+        thread.run()
+    except Exception as exc:
+        print("Exception in thread " + thread.name + ": " + repr(exc))
+    with _active_lock:
+        del _active[thread.ident]
+    thread._done.release()
+
+
+class Thread:
+    def __init__(self, group=None, target=None, name=None, args=(),
+                 kwargs=None, daemon=None):
+        if group is not None:
+            raise ValueError
+        if name is None:
+            name = _new_thread_name()
+        if kwargs is None:
+            kwargs = {}
+        self._target = target
+        self._args = args
+        self._kwargs = kwargs
+        self.name = name
+        self.daemon = not not daemon
+        self.ident = None
+        self._started = False
+        self._done = _thread.allocate_lock()
+
+    def start(self):
+        if self._started:
+            raise RuntimeError
+        self._started = True
+        self._done.acquire()
+        self.ident = _thread.start_new_thread(_bootstrap, (self,))
+
+    def run(self):
+        target = self._target
+        if target is not None:
+            target(*self._args, **self._kwargs)
+
+    def join(self, timeout=None):
+        if not self._started:
+            raise RuntimeError
+        if self.ident == get_ident():
+            raise RuntimeError
+        if timeout is None:
+            timeout = -1
+        elif timeout < 0:
+            timeout = 0
+        if self._done.acquire(True, timeout):
+            self._done.release()
+
+    def is_alive(self):
+        return self._started and self._done.locked()
+
+
+class _MainThread(Thread):
+    def __init__(self):
+        Thread.__init__(self, name="MainThread")
+        self.ident = get_ident()
+        self._started = True
+
+
+_main_thread = _MainThread()
+_active[_main_thread.ident] = _main_thread
+
+
+def main_thread():
+    return _main_thread
+
+
+def current_thread():
+    with _active_lock:
+        thread = _active.get(get_ident())
+    if thread is None:
+        return _main_thread
+    return thread
+
+
+def active_count():
+    with _active_lock:
+        return len(_active)
+
+
+def enumerate():
+    with _active_lock:
+        return list(_active.values())
@@ -398,3 +398,131 @@ try:
 except TypeError:
     result = 7
 assert result == 7
+
+
+# Tracebacks are recorded lazily while unwinding and built when the exception
+# is bound: one entry per frame from the handler frame to the raise site.
+def raise_value_error():
+    raise ValueError
+
+
+def call_raise_value_error():
+    raise_value_error()
+
+
+def catch_value_error():
+    try:
+        call_raise_value_error()
+    except ValueError as e:
+        return e
+
+
+def traceback_length(tb):
+    count = 0
+    while tb is not None:
+        count += 1
+        tb = tb.tb_next
+    return count
+
+
+assert ValueError().__traceback__ is None
+
+caught = catch_value_error()
+tb = caught.__traceback__
+assert traceback_length(tb) == 3
+assert tb.tb_code is catch_value_error.__code__
+assert tb.tb_next.tb_code is call_raise_value_error.__code__
+assert tb.tb_next.tb_next.tb_code is raise_value_error.__code__
+assert tb.tb_next.tb_next.tb_next is None
+
+
+# Handlers that match on the class without binding never observe the instance.
+result = 0
+i = 0
+while i < 3:
+    try:
+        call_raise_value_error()
+    except ValueError:
+        result += 1
+    i += 1
+assert result == 3
+
+
+# Re-raising a bound exception prepends the new frames to its traceback.
+def reraise_bound_value_error():
+    try:
+        call_raise_value_error()
+    except ValueError as e:
+        raise e
+
+
+try:
+    reraise_bound_value_error()
+except ValueError as e:
+    caught = e
+tb = caught.__traceback__
+assert traceback_length(tb) == 5
+assert tb.tb_next.tb_code is reraise_bound_value_error.__code__
+
+
+# Bare re-raises and finally blocks do not record the handler frame twice.
+def reraise_bare_value_error():
+    try:
+        call_raise_value_error()
+    except ValueError:
+        raise
+
+
+try:
+    reraise_bare_value_error()
+except ValueError as e:
+    caught = e
+tb = caught.__traceback__
+assert traceback_length(tb) == 4
+assert tb.tb_next.tb_code is reraise_bare_value_error.__code__
+assert tb.tb_next.tb_next.tb_code is call_raise_value_error.__code__
+
+
+def finally_value_error():
+    try:
+        call_raise_value_error()
+    finally:
+        pass
+
+
+try:
+    finally_value_error()
+except ValueError as e:
+    caught = e
+assert traceback_length(caught.__traceback__) == 4
+
+
+# An exception that escapes through unmatched handlers keeps one entry per
+# frame.
+def unmatched_handler():
+    try:
+        call_raise_value_error()
+    except TypeError:
+        pass
+
+
+try:
+    unmatched_handler()
+except ValueError as e:
+    caught = e
+assert traceback_length(caught.__traceback__) == 4
+
+
+class RecordingManager:
+    def __enter__(self):
+        return self
+
+    def __exit__(self, typ, exc, tb):
+        self.tb = tb
+        return True
+
+
+manager = RecordingManager()
+with manager:
+    call_raise_value_error()
+assert traceback_length(manager.tb) == 3
@@ -0,0 +1,67 @@
+# repr and str use the shortest round-tripping digits in CPython's layout:
+# fixed notation while the decimal point lands in (-4, 16], exponent
+# notation with at least two exponent digits otherwise.
+assert repr(0.0) == "0.0"
+assert repr(-0.0) == "-0.0"
+assert repr(0.1) == "0.1"
+assert repr(0.1 + 0.2) == "0.30000000000000004"
+assert repr(2.0 / 3.0) == "0.6666666666666666"
+assert repr(100.0) == "100.0"
+assert repr(-7.25) == "-7.25"
+assert repr(1e15) == "1000000000000000.0"
+assert repr(1e16) == "1e+16"
+assert repr(123456789012345678.0) == "1.2345678901234568e+17"
+assert repr(0.0001) == "0.0001"
+assert repr(0.00001) == "1e-05"
+assert repr(1.5e-7) == "1.5e-07"
+assert repr(1e22) == "1e+22"
+assert repr(5e-324) == "5e-324"
+assert repr(1.7976931348623157e308) == "1.7976931348623157e+308"
+assert repr(1e308 * 10.0) == "inf"
+assert repr(-1e308 * 10.0) == "-inf"
+assert str(2.5) == "2.5"
+assert str(1e16) == "1e+16"
+
+# float() accepts floats, ints and the float() string grammar.
+assert float() == 0.0
+assert float(2.5) == 2.5
+assert float(3) == 3.0
+assert float(True) == 1.0
+assert float(10**20) == 1e20
+assert float("1.5") == 1.5
+assert float("  -2.25\n") == -2.25
+assert float("+1e3") == 1000.0
+assert float("1E-3") == 0.001
+assert float(".5") == 0.5
+assert float("5.") == 5.0
+assert float("1_000.000_1") == 1000.0001
+assert float("0.1") == 0.1
+assert float("2.2250738585072014e-308") == 2.2250738585072014e-308
+assert float("1e999") == float("inf")
+assert float("-1e-999") == 0.0
+assert repr(float("-1e-999")) == "-0.0"
+assert float("inf") > 1e308
+assert float("-Infinity") < -1e308
+nan = float("nan")
+assert nan != nan
+assert repr(float("-NaN")) == "nan"
+
+for text in ["", " ", "abc", "1__0", "_1", "1_", "1_e5", "1e", "--1", "+-1",
+             "1.2.3", "0x10", "infinit", "1 2"]:
+    try:
+        float(text)
+        assert False
+    except ValueError:
+        pass
+
+try:
+    float([])
+    assert False
+except TypeError:
+    pass
+
+# repr output parses back to the same value.
+value = 0.1
+for _ in range(200):
+    assert float(repr(value)) == value
+    value = value * 1.37 + 0.001
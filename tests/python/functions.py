@@ -291,3 +291,60 @@ def __clover_ternary_pow__(a, b, modulo):
 
 
 assert __clover_ternary_pow__(2, 3, 5) == 123
+
+
+# Caller-side argument unpacking.
+def forward_target(a, b, c=3):
+    return a * 100 + b * 10 + c
+
+
+def forward(*args, **kwargs):
+    return forward_target(*args, **kwargs)
+
+
+assert forward(1, 2) == 123
+assert forward(1, 2, 4) == 124
+assert forward(1, b=2, c=5) == 125
+assert forward(*[1, 2]) == 123
+assert forward_target(*(1,), *[2], 6) == 126
+assert forward_target(1, *(2,), **{}) == 123
+assert forward_target(*(), **{"a": 1, "b": 2}) == 123
+assert forward_target(**{"a": 1}, **{"b": 2, "c": 7}) == 127
+assert forward_target(1, **{"c": 8}, b=2) == 128
+assert varargs(*[1, 2, 3]) == varargs(1, 2, 3)
+
+
+def collect_kwargs(**kwargs):
+    return kwargs
+
+
+unpacked_kwargs = collect_kwargs(**{"x": 1}, y=2)
+assert len(unpacked_kwargs) == 2
+assert unpacked_kwargs["x"] == 1
+assert unpacked_kwargs["y"] == 2
+
+evaluation_order = []
+
+
+def record_arg(value):
+    evaluation_order.append(value)
+    return value
+
+
+forward_target(record_arg(1), *[record_arg(2)], c=record_arg(3))
+assert len(evaluation_order) == 3
+assert evaluation_order[0] == 1
+assert evaluation_order[1] == 2
+assert evaluation_order[2] == 3
+
+try:
+    forward_target(*[1, 2], **{"a": 3})
+    assert False
+except TypeError:
+    pass
+
+try:
+    collect_kwargs(**{"x": 1}, x=2)
+    assert False
+except TypeError:
+    pass
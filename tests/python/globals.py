@@ -31,3 +31,16 @@ assert range == 42
 # Deleting a global shadow reveals the builtin with the same name.
 del range
 assert next(range(1)) == 0
+
+# Global calls see later rebinding of both module globals and builtin fallbacks.
+def call_len(xs):
+    return len(xs)
+
+assert call_len([1, 2]) == 2
+
+def len(xs):
+    return 99
+
+assert call_len([1, 2]) == 99
+del len
+assert call_len([1, 2, 3]) == 3
@@ -170,3 +170,121 @@ assert min((3, 1, 2)) == 1
 assert min(3, 1, 2) == 1
 assert max([3, 1, 2]) == 3
 assert max(3, 1, 2) == 3
+
+# abs dispatches through __abs__.
+assert abs(-3) == 3
+assert abs(3) == 3
+assert abs(True) == 1
+assert abs(-2.5) == 2.5
+assert abs(-(10**30)) == 10**30
+assert abs(-4611686018427387904) == 4611686018427387904
+
+
+class CustomAbs:
+    def __abs__(self):
+        return "abs"
+
+
+assert abs(CustomAbs()) == "abs"
+
+try:
+    abs("text")
+    assert False
+except TypeError:
+    pass
+
+
+# Specialized builtin call sites agree with the complete builtins, including
+# after a site sees a second argument shape.
+def call_len(value):
+    return len(value)
+
+
+def call_hash(value):
+    return hash(value)
+
+
+def call_abs(value):
+    return abs(value)
+
+
+def call_min(a, b):
+    return min(a, b)
+
+
+def call_max(a, b):
+    return max(a, b)
+
+
+def call_isinstance(value, cls):
+    return isinstance(value, cls)
+
+
+def call_getattr(obj, name):
+    return getattr(obj, name)
+
+
+def call_getattr_default(obj, name, default):
+    return getattr(obj, name, default)
+
+
+class Holder:
+    pass
+
+
+holder = Holder()
+holder.value = 7
+
+i = 0
+while i < 3:
+    assert call_len([1, 2, 3]) == 3
+    assert call_hash(-1) == -2
+    assert call_abs(-7) == 7
+    assert call_min(4, 2) == 2
+    assert call_max(4, 2) == 4
+    assert call_min(1.5, 0.5) == 0.5
+    assert call_isinstance(True, int)
+    assert call_getattr(holder, "value") == 7
+    assert call_getattr_default(holder, "missing", 5) == 5
+    i += 1
+
+assert call_len("abcd") == 4
+assert call_len({"a": 1}) == 1
+assert call_hash("clover") == hash("clover")
+assert call_hash(CustomHash()) == 123
+assert call_abs(-2.0) == 2.0
+assert call_min("b", "a") == "a"
+assert call_max(1, 2.5) == 2.5
+
+
+
+def call_max_float(a, b):
+    return max(a, b)
+
+
+def call_min_float(a, b):
+    return min(a, b)
+
+
+# A specialized float site keeps the first argument on ties and NaNs, like
+# the complete builtin.
+infinity = 1e308 * 10.0
+nan = infinity - infinity
+first_float = 1.0
+i = 0
+while i < 3:
+    assert call_max_float(nan, 1.0) is nan
+    assert call_min_float(first_float, 1.0) is first_float
+    i += 1
+
+try:
+    call_getattr(holder, "missing")
+    assert False
+except AttributeError:
+    pass
+
+try:
+    call_isinstance(1, 2)
+    assert False
+except TypeError:
+    pass
@@ -74,3 +74,46 @@ try:
     assert False
 except TypeError:
     pass
+
+
+def repeated_digits(digit, count):
+    parts = []
+    for _ in range(count):
+        parts.append(digit)
+    return "".join(parts)
+
+
+assert sys.get_int_max_str_digits() == 0
+big_text = repeated_digits("1", 700)
+big_value = int(big_text)
+assert str(big_value) == big_text
+sys.set_int_max_str_digits(640)
+assert sys.get_int_max_str_digits() == 640
+assert int(repeated_digits("7", 640)) % 10 == 7
+
+try:
+    int(big_text)
+    assert False
+except ValueError:
+    pass
+
+try:
+    str(big_value)
+    assert False
+except ValueError:
+    pass
+
+try:
+    str(-big_value)
+    assert False
+except ValueError:
+    pass
+
+try:
+    sys.set_int_max_str_digits(639)
+    assert False
+except ValueError:
+    pass
+
+sys.set_int_max_str_digits(0)
+assert str(big_value) == big_text
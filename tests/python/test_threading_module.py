@@ -0,0 +1,139 @@
+# Python test set -- _thread and threading modules
+
+import _thread
+import sys
+import threading
+import time
+
+
+assert "_thread" in sys.builtin_module_names
+
+lock = _thread.allocate_lock()
+assert not lock.locked()
+assert lock.acquire()
+assert lock.locked()
+assert not lock.acquire(False)
+assert not lock.acquire(True, 0)
+assert not lock.acquire(timeout=0.01)
+lock.release()
+assert not lock.locked()
+try:
+    lock.release()
+    assert False
+except RuntimeError:
+    pass
+try:
+    lock.acquire(False, 1)
+    assert False
+except ValueError:
+    pass
+with lock:
+    assert lock.locked()
+assert not lock.locked()
+assert isinstance(lock, _thread.LockType)
+
+main_ident = _thread.get_ident()
+assert threading.get_ident() == main_ident
+assert threading.main_thread().ident == main_ident
+assert threading.current_thread() is threading.main_thread()
+
+
+# Raw start_new_thread: the parent spins on a flag, which only another thread
+# can set, so the loop back edge must hand the VM over.
+state = [0, None]
+
+
+def raw_worker(value):
+    state[1] = _thread.get_ident()
+    state[0] = value
+
+
+raw_ident = _thread.start_new_thread(raw_worker, (7,))
+while state[0] == 0:
+    pass
+assert state[0] == 7
+assert state[1] == raw_ident
+assert raw_ident != main_ident
+
+
+# Shared counter under a lock, incremented from several threads that also
+# sleep, so both blocking paths (lock wait and sleep) detach.
+counter = [0]
+counter_lock = threading.Lock()
+
+
+def add(n):
+    for i in range(n):
+        with counter_lock:
+            value = counter[0]
+            if i % 50 == 0:
+                time.sleep(0.0001)
+            counter[0] = value + 1
+
+
+workers = []
+for i in range(4):
+    worker = threading.Thread(target=add, args=(200,))
+    workers.append(worker)
+for worker in workers:
+    worker.start()
+for worker in workers:
+    worker.join()
+    assert not worker.is_alive()
+assert counter[0] == 800
+
+
+# join(timeout) returns while the thread is still blocked on a lock.
+gate = threading.Lock()
+gate.acquire()
+seen = []
+
+
+def wait_for_gate(tag):
+    with gate:
+        seen.append(tag)
+    seen.append(threading.current_thread().name)
+
+
+waiter = threading.Thread(target=wait_for_gate, name="gate-waiter",
+                          kwargs={"tag": "through"})
+waiter.start()
+waiter.join(0.01)
+assert waiter.is_alive()
+assert len(seen) == 0
+gate.release()
+waiter.join()
+assert len(seen) == 2
+assert seen[0] == "through"
+assert seen[1] == "gate-waiter"
+assert waiter.ident is not None
+assert waiter.ident != main_ident
+
+
+# Subclasses override run().
+class Squarer(threading.Thread):
+    def __init__(self, n):
+        threading.Thread.__init__(self)
+        self.n = n
+        self.result = None
+
+    def run(self):
+        self.result = self.n * self.n
+
+
+squarer = Squarer(12)
+squarer.start()
+squarer.join()
+assert squarer.result == 144
+try:
+    squarer.start()
+    assert False
+except RuntimeError:
+    pass
+
+
+rlock = threading.RLock()
+with rlock:
+    with rlock:
+        assert rlock._count == 2
+assert rlock._owner is None
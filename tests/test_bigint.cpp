@@ -9,6 +9,8 @@
 #include <gtest/gtest.h>
 #include <limits>
 #include <string>
+#include <utility>
+#include <vector>
 
 using namespace cl;
 
@@ -554,6 +556,206 @@ TEST(BigInt, MulAccumulatesMultiDigitProducts)
     EXPECT_EQ(3u, view.digits[2]);
 }
 
+TEST(BigInt, MulSquaresLargeAllOnesMagnitudes)
+{
+    test::VmTestContext context;
+    ThreadState::ActivationScope activation_scope(context.thread());
+
+    // (B^n - 1)^2 = B^2n - 2 B^n + 1. The sizes cover the schoolbook,
+    // Karatsuba and Toom-3 multiplication paths.
+    for(size_t n_digits: {20, 90, 700})
+    {
+        std::vector<digit_t> ones(n_digits, 0xffffffffu);
+        ConstBigIntView operand{n_digits, -1, ones.data()};
+
+        Expected<Value> result =
+            bigint_mul(context.thread(), operand, operand);
+
+        ASSERT_TRUE(result.has_value());
+        ASSERT_TRUE(can_convert_to<BigInt>(result.value()));
+        ConstBigIntView view =
+            assume_convert_to<BigInt>(result.value())->view();
+        ASSERT_EQ(2 * n_digits, view.n_digits);
+        EXPECT_EQ(1, view.signum);
+        EXPECT_EQ(1u, view.digits[0]);
+        for(size_t idx = 1; idx < n_digits; ++idx)
+        {
+            EXPECT_EQ(0u, view.digits[idx]) << idx;
+        }
+        EXPECT_EQ(0xfffffffeu, view.digits[n_digits]);
+        for(size_t idx = n_digits + 1; idx < 2 * n_digits; ++idx)
+        {
+            EXPECT_EQ(0xffffffffu, view.digits[idx]) << idx;
+        }
+    }
+}
+
+TEST(BigInt, MulLargeProductsDivideBackToTheirFactors)
+{
+    test::VmTestContext context;
+    ThreadState::ActivationScope activation_scope(context.thread());
+
+    uint64_t state = 0x9e3779b97f4a7c15u;
+    auto make_digits = [&state](size_t n_digits) {
+        std::vector<digit_t> digits(n_digits);
+        for(digit_t &digit: digits)
+        {
+            state = state * 6364136223846793005u + 1442695040888963407u;
+            digit = static_cast<digit_t>(state >> 32);
+        }
+        digits.back() |= 1;
+        return digits;
+    };
+
+    // Balanced, unbalanced and Toom-3 sized operands, divided back out by
+    // Knuth and recursive long division.
+    std::pair<size_t, size_t> shapes[] = {{64, 50}, {900, 70}, {600, 500}};
+    for(auto [left_n, right_n]: shapes)
+    {
+        std::vector<digit_t> left_digits = make_digits(left_n);
+        std::vector<digit_t> right_digits = make_digits(right_n);
+        ConstBigIntView left{left_n, 1, left_digits.data()};
+        ConstBigIntView right{right_n, -1, right_digits.data()};
+
+        Expected<Value> product = bigint_mul(context.thread(), left, right);
+        ASSERT_TRUE(product.has_value());
+        ASSERT_TRUE(can_convert_to<BigInt>(product.value()));
+        ConstBigIntView product_view =
+            assume_convert_to<BigInt>(product.value())->view();
+        EXPECT_EQ(-1, product_view.signum);
+
+        Expected<Value> quotient =
+            bigint_floor_div(context.thread(), product_view, right);
+        Expected<Value> remainder =
+            bigint_mod(context.thread(), product_view, right);
+        ASSERT_TRUE(quotient.has_value());
+        ASSERT_TRUE(remainder.has_value());
+        EXPECT_EQ(Value::from_smi(0), remainder.value());
+        ASSERT_TRUE(can_convert_to<BigInt>(quotient.value()));
+        EXPECT_EQ(0, compare_bigint(
+                         left,
+                         assume_convert_to<BigInt>(quotient.value())->view()));
+    }
+}
+
+TEST(BigInt, RecursiveFloorDivModReconstructsDividend)
+{
+    test::VmTestContext context;
+    ThreadState::ActivationScope activation_scope(context.thread());
+
+    uint64_t state = 0x2545f4914f6cdd1du;
+    auto make_digits = [&state](size_t n_digits) {
+        std::vector<digit_t> digits(n_digits);
+        for(digit_t &digit: digits)
+        {
+            state = state * 6364136223846793005u + 1442695040888963407u;
+            digit = static_cast<digit_t>(state >> 32);
+        }
+        digits.back() |= 1;
+        return digits;
+    };
+
+    // Divisor sizes on both sides of the Burnikel-Ziegler block split,
+    // including one whose top digit needs no normalization shift.
+    std::pair<size_t, size_t> shapes[] = {{700, 64}, {1000, 150}, {2000, 999}};
+    for(auto [left_n, right_n]: shapes)
+    {
+        std::vector<digit_t> left_digits = make_digits(left_n);
+        std::vector<digit_t> right_digits = make_digits(right_n);
+        if(right_n == 150)
+        {
+            right_digits.back() = 0xffffffffu;
+        }
+        ConstBigIntView left{left_n, 1, left_digits.data()};
+        ConstBigIntView right{right_n, 1, right_digits.data()};
+
+        Expected<Value> quotient =
+            bigint_floor_div(context.thread(), left, right);
+        Expected<Value> remainder = bigint_mod(context.thread(), left, right);
+        ASSERT_TRUE(quotient.has_value());
+        ASSERT_TRUE(remainder.has_value());
+        ASSERT_TRUE(can_convert_to<BigInt>(quotient.value()));
+        ASSERT_TRUE(can_convert_to<BigInt>(remainder.value()));
+        ConstBigIntView remainder_view =
+            assume_convert_to<BigInt>(remainder.value())->view();
+        EXPECT_EQ(1, remainder_view.signum);
+        EXPECT_LT(compare_bigint(remainder_view, right), 0);
+
+        Expected<Value> product = bigint_mul(
+            context.thread(),
+            assume_convert_to<BigInt>(quotient.value())->view(), right);
+        ASSERT_TRUE(product.has_value());
+        Expected<Value> reconstructed = bigint_add(
+            context.thread(),
+            assume_convert_to<BigInt>(product.value())->view(),
+            remainder_view);
+        ASSERT_TRUE(reconstructed.has_value());
+        ASSERT_TRUE(can_convert_to<BigInt>(reconstructed.value()));
+        EXPECT_EQ(0,
+                  compare_bigint(
+                      left,
+                      assume_convert_to<BigInt>(reconstructed.value())->view()))
+            << left_n << "/" << right_n;
+    }
+}
+
+TEST(BigInt, DecimalDigitsRoundTripAcrossConversionThresholds)
+{
+    test::VmTestContext context;
+    ThreadState::ActivationScope activation_scope(context.thread());
+
+    uint64_t state = 0x853c49e6748fea9bu;
+    auto make_decimal = [&state](size_t n_chars) {
+        std::string digits(n_chars, '0');
+        for(char &ch: digits)
+        {
+            state = state * 6364136223846793005u + 1442695040888963407u;
+            ch = static_cast<char>('0' + (state >> 33) % 10);
+        }
+        digits.front() = '7';
+        return digits;
+    };
+
+    std::vector<std::string> cases = {make_decimal(100), make_decimal(1500),
+                                      make_decimal(12000),
+                                      "1" + std::string(20000, '0')};
+    for(const std::string &digits: cases)
+    {
+        for(signum_t signum: {signum_t{1}, signum_t{-1}})
+        {
+            Expected<Value> value =
+                bigint_from_decimal_digits(context.thread(), digits, signum);
+            ASSERT_TRUE(value.has_value());
+            ASSERT_TRUE(can_convert_to<BigInt>(value.value()));
+
+            std::wstring expected(digits.begin(), digits.end());
+            if(signum < 0)
+            {
+                expected.insert(expected.begin(), L'-');
+            }
+            EXPECT_EQ(expected, int_value_decimal(value.value()))
+                << digits.size();
+        }
+    }
+}
+
+TEST(BigInt, DecimalDigitsFinalizeLeadingZerosToSmi)
+{
+    test::VmTestContext context;
+    ThreadState::ActivationScope activation_scope(context.thread());
+
+    std::string digits = std::string(3000, '0') + "42";
+    Expected<Value> value =
+        bigint_from_decimal_digits(context.thread(), digits, -1);
+    ASSERT_TRUE(value.has_value());
+    EXPECT_EQ(Value::from_smi(-42), value.value());
+
+    Expected<Value> zero = bigint_from_decimal_digits(
+        context.thread(), std::string(2000, '0'), 1);
+    ASSERT_TRUE(zero.has_value());
+    EXPECT_EQ(Value::from_smi(0), zero.value());
+}
+
 TEST(BigInt, FloorDivUsesPythonSignedSemantics)
 {
     test::VmTestContext context;
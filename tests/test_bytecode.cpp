@@ -93,6 +93,10 @@ TEST(BytecodeFormat, representative_operand_formats_have_expected_lengths)
     EXPECT_EQ(6, bytecode_length(Bytecode::CallMethodAttrPositional));
     EXPECT_EQ(9, bytecode_length(Bytecode::CallMethodAttrKeyword));
     EXPECT_EQ(8, bytecode_length(Bytecode::CallKeyword));
+    EXPECT_EQ(7, bytecode_length(Bytecode::CallGlobalSimple));
+    EXPECT_EQ(5, bytecode_length(Bytecode::CallUnpack));
+    EXPECT_EQ(5, bytecode_length(Bytecode::CallUnpackKeyword));
+    EXPECT_EQ(4, bytecode_length(Bytecode::LoadMethodAttr));
     EXPECT_EQ(7, bytecode_length(Bytecode::DictInsertNew));
     EXPECT_EQ(4, bytecode_length(Bytecode::LShiftSmi));
     EXPECT_EQ(3, bytecode_length(Bytecode::Contains));
@@ -159,8 +163,8 @@ TEST(BytecodeInstruction, compact_register_forms_are_normalized)
                                                    L"f(1)\n");
 
     BytecodeInstruction instruction =
-        find_instruction(*code_object, Bytecode::Star0);
-    EXPECT_EQ(Bytecode::Star0, instruction.encoded_opcode());
+        find_instruction(*code_object, Bytecode::Star2);
+    EXPECT_EQ(Bytecode::Star2, instruction.encoded_opcode());
     EXPECT_EQ(Bytecode::Star, instruction.semantic_opcode());
     ASSERT_EQ(1, instruction.operands().size());
     EXPECT_EQ(BytecodeOperandKind::Register, instruction.operands()[0].kind);
@@ -255,6 +259,36 @@ TEST(BytecodeInstruction, two_cache_instruction_preserves_both_typed_operands)
     EXPECT_TRUE(found_decoded_call);
 }
 
+TEST(BytecodeInstruction, global_call_writes_callable_and_reads_arguments)
+{
+    test::VmTestContext context;
+    CodeObject *code_object = context.compile_file(L"f(1, 2)\n");
+
+    BytecodeInstruction instruction =
+        find_instruction(*code_object, Bytecode::CallGlobalSimple);
+    bool has_module_global_read_cache = false;
+    bool has_function_call_cache = false;
+    for(const BytecodeOperand &operand: instruction.operands())
+    {
+        has_module_global_read_cache |=
+            operand.kind == BytecodeOperandKind::ModuleGlobalReadCache;
+        has_function_call_cache |=
+            operand.kind == BytecodeOperandKind::FunctionCallCache;
+    }
+    EXPECT_TRUE(has_module_global_read_cache);
+    EXPECT_TRUE(has_function_call_cache);
+    ASSERT_EQ(2, instruction.sources().size());
+    EXPECT_EQ(BytecodeValueLocationKind::StackSlot,
+              instruction.sources()[0].kind);
+    EXPECT_EQ(BytecodeValueLocationKind::StackSlot,
+              instruction.sources()[1].kind);
+    ASSERT_EQ(2, instruction.destinations().size());
+    EXPECT_EQ(BytecodeValueLocationKind::StackSlot,
+              instruction.destinations()[0].kind);
+    EXPECT_EQ(BytecodeValueLocationKind::Accumulator,
+              instruction.destinations()[1].kind);
+}
+
 TEST(BytecodeInstruction, range_loop_effects_are_uniform_and_rmw)
 {
     test::VmTestContext context;
@@ -491,7 +525,7 @@ TEST(BytecodeDecoder, block_instructions_use_stable_cache_snapshots)
     live_cache.n_args = 12;
 
     BytecodeInstruction standalone =
-        find_instruction(*code_object, Bytecode::CallPositional);
+        find_instruction(*code_object, Bytecode::CallGlobalSimple);
     EXPECT_EQ(nullptr, standalone.function_call_cache());
 
     BytecodeDecoder decoder(*code_object);
@@ -502,7 +536,7 @@ TEST(BytecodeDecoder, block_instructions_use_stable_cache_snapshots)
     {
         for(BytecodeInstruction instruction: block.instructions())
         {
-            if(instruction.encoded_opcode() == Bytecode::CallPositional)
+            if(instruction.encoded_opcode() == Bytecode::CallGlobalSimple)
             {
                 snapshot = instruction.function_call_cache();
             }
@@ -498,16 +498,15 @@ TEST(Codegen, function_multiple_parameters)
         "Code object:\n"
         "    0 CreateFunction c[0]\n"
         "    2 StaGlobal c[1], module_global_mutation_ic[0]\n"
-        "    5 LdaGlobal c[1], module_global_read_ic[0]\n"
-        "    8 Star0\n"
-        "    9 LdaSmi 1\n"
-        "   11 Star2\n"
-        "   12 LdaSmi 2\n"
-        "   14 Star3\n"
-        "   15 LdaSmi 3\n"
-        "   17 Star4\n"
-        "   18 CallPositional r0, {r2..r4}, call_ic[0]\n"
-        "   23 Return\n"
+        "    5 LdaSmi 1\n"
+        "    7 Star2\n"
+        "    8 LdaSmi 2\n"
+        "   10 Star3\n"
+        "   11 LdaSmi 3\n"
+        "   13 Star4\n"
+        "   14 CallGlobalSimple c[1], module_global_read_ic[0], r0, "
+        "{r2..r4}, call_ic[0]\n"
+        "   21 Return\n"
         "Constant 0: Code object:\n"
         "    0 Ldar p1\n"
         "    2 Add p0, operator_ic[0]\n"
@@ -562,6 +561,55 @@ TEST(Codegen, function_keyword_call)
     EXPECT_EQ(expected, actual);
 }
 
+TEST(Codegen, forwarding_star_call_passes_tuple_through)
+{
+    std::string actual =
+        bytecode_str_from_file(L"def wrapper(*args):\n"
+                               L"    return target(*args)\n");
+
+    EXPECT_NE(std::string::npos, actual.find("ClearLocal"));
+    EXPECT_NE(std::string::npos, actual.find("CallUnpack"));
+    EXPECT_EQ(std::string::npos, actual.find("CallUnpackKeyword"));
+    EXPECT_EQ(std::string::npos, actual.find("CreateTuple"));
+    EXPECT_EQ(std::string::npos, actual.find("ConcatUnpackArgs"));
+}
+
+TEST(Codegen, star_call_segments_are_concatenated)
+{
+    std::string actual =
+        bytecode_str_from_file(L"def call(a, b):\n"
+                               L"    return target(1, *a, 2, 3, *b)\n");
+
+    EXPECT_NE(std::string::npos, actual.find("CreateTuple {r7:1}"));
+    EXPECT_NE(std::string::npos, actual.find("CreateTuple {r7..r8}"));
+    EXPECT_NE(std::string::npos, actual.find("ConcatUnpackArgs {r3..r6}"));
+}
+
+TEST(Codegen, double_star_call_merges_keyword_segments)
+{
+    std::string actual =
+        bytecode_str_from_file(L"def call(k):\n"
+                               L"    return target(*(), x=1, **k)\n");
+
+    EXPECT_NE(std::string::npos, actual.find("CreateDict"));
+    EXPECT_NE(std::string::npos, actual.find("MergeUnpackKwargs"));
+    EXPECT_NE(std::string::npos, actual.find("CallUnpackKeyword"));
+}
+
+TEST(Codegen, method_star_call_loads_method_before_arguments)
+{
+    std::string actual =
+        bytecode_str_from_file(L"def call(obj, args):\n"
+                               L"    return obj.m(*args)\n");
+
+    size_t load_method = actual.find("LoadMethodAttr");
+    size_t call = actual.find("CallUnpack");
+    ASSERT_NE(std::string::npos, load_method);
+    ASSERT_NE(std::string::npos, call);
+    EXPECT_LT(load_method, call);
+    EXPECT_EQ(std::string::npos, actual.find("CallMethodAttr"));
+}
+
 TEST(Codegen, function_defaults_use_create_function_with_defaults)
 {
     const wchar_t *test_case = L"def f(a, b=2):\n"
@@ -576,12 +624,11 @@ TEST(Codegen, function_defaults_use_create_function_with_defaults)
         "    6 Star1\n"
         "    7 CreateFunctionWithDefaults c[0], r1\n"
         "   10 StaGlobal c[1], module_global_mutation_ic[0]\n"
-        "   13 LdaGlobal c[1], module_global_read_ic[0]\n"
-        "   16 Star0\n"
-        "   17 LdaSmi 1\n"
-        "   19 Star2\n"
-        "   20 CallPositional r0, {r2:1}, call_ic[0]\n"
-        "   25 Return\n"
+        "   13 LdaSmi 1\n"
+        "   15 Star2\n"
+        "   16 CallGlobalSimple c[1], module_global_read_ic[0], r0, "
+        "{r2:1}, call_ic[0]\n"
+        "   23 Return\n"
         "Constant 0: Code object:\n"
         "    0 Ldar p1\n"
         "    2 Add p0, operator_ic[0]\n"
@@ -960,7 +1007,7 @@ TEST(Codegen, bare_raise_in_handler_uses_saved_exception_register)
                            "   11 JumpIfFalse 21\n"
                            "   14 DrainActiveExceptionInto r0\n"
                            "   16 Ldar0\n"
-                           "   17 RaiseUnwind\n"
+                           "   17 ReraiseUnwind\n"
                            "   18 Jump 22\n"
                            "   21 ReraiseActiveException\n"
                            "   22 Return\n"
@@ -1017,7 +1064,7 @@ TEST(Codegen, try_finally_emits_normal_and_exceptional_cleanup_paths)
         "   15 LdaSmi 2\n"
         "   17 StaGlobal c[0], module_global_mutation_ic[2]\n"
         "   20 Ldar0\n"
-        "   21 RaiseUnwind\n"
+        "   21 ReraiseUnwind\n"
         "   22 LdaGlobal c[0], module_global_read_ic[0]\n"
         "   25 Return\n"
         "Exception table:\n"
@@ -1049,7 +1096,7 @@ TEST(Codegen, except_as_without_bare_raise_drains_and_clears_local)
                                              "   26 Star0\n"
                                              "   27 DelLocal r0\n"
                                              "   29 Ldar1\n"
-                                             "   30 RaiseUnwind"));
+                                             "   30 ReraiseUnwind"));
 }
 
 TEST(Codegen, except_as_with_bare_raise_keeps_hidden_original)
@@ -1065,7 +1112,7 @@ TEST(Codegen, except_as_with_bare_raise_keeps_hidden_original)
                                              "   16 Ldar1\n"
                                              "   17 Star0"));
     EXPECT_NE(std::string::npos, actual.find("   22 Ldar1\n"
-                                             "   23 RaiseUnwind"));
+                                             "   23 ReraiseUnwind"));
 }
 
 TEST(Codegen, bare_raise_outside_handler_is_runtime_reraise)
@@ -1088,10 +1135,9 @@ TEST(Codegen, function_implicit_return_none)
         "Code object:\n"
         "    0 CreateFunction c[0]\n"
         "    2 StaGlobal c[1], module_global_mutation_ic[0]\n"
-        "    5 LdaGlobal c[1], module_global_read_ic[0]\n"
-        "    8 Star0\n"
-        "    9 CallPositional r0, {r2:0}, call_ic[0]\n"
-        "   14 Return\n"
+        "    5 CallGlobalSimple c[1], module_global_read_ic[0], r0, "
+        "{r2:0}, call_ic[0]\n"
+        "   12 Return\n"
         "Constant 0: Code object:\n"
         "    0 LdaSmi 1\n"
         "    2 Star0\n"
@@ -1178,8 +1224,8 @@ TEST(Codegen, float_literal_constant_value)
 
     ASSERT_EQ(size_t(1), code_obj->constant_table.size());
     Value constant = code_obj->constant_table[0].value();
-    ASSERT_TRUE(can_convert_to<Float>(constant));
-    EXPECT_DOUBLE_EQ(1.5, constant.get_ptr<Float>()->value());
+    ASSERT_TRUE(is_float_value(constant));
+    EXPECT_DOUBLE_EQ(1.5, float_value(constant));
 }
 
 TEST(Codegen, attribute_load_uses_register_receiver)
@@ -1705,30 +1751,29 @@ TEST(Codegen, non_direct_for_loop_uses_generic_iterator_protocol_calls)
 {
     std::string expected =
         "Code object:\n"
-        "    0 LdaGlobal c[0], module_global_read_ic[0]\n"
-        "    3 Star0\n"
-        "    4 LdaSmi 3\n"
-        "    6 Star2\n"
-        "    7 CallPositional r0, {r2:1}, call_ic[0]\n"
-        "   12 StaGlobal c[1], module_global_mutation_ic[0]\n"
-        "   15 LdaGlobal c[1], module_global_read_ic[1]\n"
-        "   18 Star2\n"
-        "   19 CallSpecialMethod0 r2, c[2], operator_ic[0], c[3], c[4]\n"
-        "   25 Star0\n"
-        "   26 Mov r2, r0\n"
-        "   29 CallSpecialMethod0 r2, c[5], operator_ic[1], c[3], c[6]\n"
-        "   35 StaGlobal c[8], module_global_mutation_ic[1]\n"
-        "   38 LdaGlobal c[8], module_global_read_ic[2]\n"
-        "   41 Jump 26\n"
-        "   44 LdaConstant c[7]\n"
-        "   46 ActiveExceptionIsInstance\n"
-        "   47 JumpIfFalse 54\n"
-        "   50 ClearActiveException\n"
-        "   51 Jump 55\n"
-        "   54 ReraiseActiveException\n"
-        "   55 Return\n"
+        "    0 LdaSmi 3\n"
+        "    2 Star2\n"
+        "    3 CallGlobalSimple c[0], module_global_read_ic[0], r0, "
+        "{r2:1}, call_ic[0]\n"
+        "   10 StaGlobal c[1], module_global_mutation_ic[0]\n"
+        "   13 LdaGlobal c[1], module_global_read_ic[1]\n"
+        "   16 Star2\n"
+        "   17 CallSpecialMethod0 r2, c[2], operator_ic[0], c[3], c[4]\n"
+        "   23 Star0\n"
+        "   24 Mov r2, r0\n"
+        "   27 CallSpecialMethod0 r2, c[5], operator_ic[1], c[3], c[6]\n"
+        "   33 StaGlobal c[8], module_global_mutation_ic[1]\n"
+        "   36 LdaGlobal c[8], module_global_read_ic[2]\n"
+        "   39 Jump 24\n"
+        "   42 LdaConstant c[7]\n"
+        "   44 ActiveExceptionIsInstance\n"
+        "   45 JumpIfFalse 52\n"
+        "   48 ClearActiveException\n"
+        "   49 Jump 53\n"
+        "   52 ReraiseActiveException\n"
+        "   53 Return\n"
         "Exception table:\n"
-        "    29..35 -> 44\n"
+        "    27..33 -> 42\n"
         "Constant 0: \"range\"\n"
         "Constant 1: \"it\"\n"
         "Constant 2: \"__iter__\"\n"
@@ -1862,7 +1907,7 @@ TEST(Codegen, user_clover_write_stdout_name_is_ordinary_call)
                                L"    return __clover_write_stdout__(value)\n");
 
     EXPECT_EQ(std::string::npos, actual.find("WriteStdout"));
-    EXPECT_NE(std::string::npos, actual.find("CallPositional"));
+    EXPECT_NE(std::string::npos, actual.find("CallGlobalSimple"));
 }
 
 TEST(Codegen, trusted_clover_globals_lowers_to_intrinsic)
@@ -1899,7 +1944,7 @@ TEST(Codegen, user_clover_globals_name_is_ordinary_call)
                                L"    return __clover_globals__()\n");
 
     EXPECT_EQ(std::string::npos, actual.find("CallRuntimeIntrinsic0 Globals"));
-    EXPECT_NE(std::string::npos, actual.find("CallPositional"));
+    EXPECT_NE(std::string::npos, actual.find("CallGlobalSimple"));
 }
 
 TEST(Codegen, trusted_clover_locals_lowers_to_intrinsic)
@@ -1919,7 +1964,7 @@ TEST(Codegen, user_clover_locals_name_is_ordinary_call)
                                L"    return __clover_locals__()\n");
 
     EXPECT_EQ(std::string::npos, actual.find("CallRuntimeIntrinsic0 Locals"));
-    EXPECT_NE(std::string::npos, actual.find("CallPositional"));
+    EXPECT_NE(std::string::npos, actual.find("CallGlobalSimple"));
 }
 
 TEST(Codegen, trusted_clover_sqrt_lowers_to_opcode)
@@ -1947,7 +1992,7 @@ TEST(Codegen, user_clover_sqrt_name_is_ordinary_call)
                                L"    return __clover_sqrt__(value)\n");
 
     EXPECT_EQ(std::string::npos, actual.find("Sqrt"));
-    EXPECT_NE(std::string::npos, actual.find("CallPositional"));
+    EXPECT_NE(std::string::npos, actual.find("CallGlobalSimple"));
 }
 
 TEST(Codegen, trusted_clover_ternary_pow_lowers_to_opcode)
@@ -1994,7 +2039,7 @@ TEST(Codegen, user_clover_canonicalize_hash_name_is_ordinary_call)
         L"    return __clover_canonicalize_hash__(value)\n");
 
     EXPECT_EQ(std::string::npos, actual.find("CanonicalizeHash"));
-    EXPECT_NE(std::string::npos, actual.find("CallPositional"));
+    EXPECT_NE(std::string::npos, actual.find("CallGlobalSimple"));
 }
 
 TEST(Codegen, user_clover_ternary_pow_name_is_ordinary_call)
@@ -2005,5 +2050,5 @@ TEST(Codegen, user_clover_ternary_pow_name_is_ordinary_call)
                                L"modulo)\n");
 
     EXPECT_EQ(std::string::npos, actual.find("TernaryPow"));
-    EXPECT_NE(std::string::npos, actual.find("CallPositional"));
+    EXPECT_NE(std::string::npos, actual.find("CallGlobalSimple"));
 }
@@ -0,0 +1,179 @@
+#include <clovervm/clovervm.h>
+
+#include <gtest/gtest.h>
+#include <string>
+#include <sys/wait.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+namespace
+{
+    TEST(EmbeddingApi, CompiledCodeRunsRepeatedlyInOneModule)
+    {
+        clover_vm *vm = clover_vm_new();
+        clover_code *code = clover_vm_compile(vm,
+                                              "try:\n"
+                                              "    calls += 1\n"
+                                              "except NameError:\n"
+                                              "    calls = 1\n"
+                                              "assert calls < 3\n",
+                                              "counter.py");
+        ASSERT_NE(nullptr, code);
+
+        EXPECT_EQ(CLOVER_STATUS_OK, clover_vm_call(vm, code));
+        EXPECT_EQ(CLOVER_STATUS_OK, clover_vm_call(vm, code));
+        EXPECT_EQ(CLOVER_STATUS_ERROR, clover_vm_call(vm, code));
+
+        clover_code_destroy(code);
+        clover_vm_destroy(vm);
+    }
+
+    TEST(EmbeddingApi, CompileReportsSyntaxErrors)
+    {
+        clover_vm *vm = clover_vm_new();
+        EXPECT_EQ(nullptr, clover_vm_compile(vm, "def (:\n", nullptr));
+        EXPECT_EQ(nullptr, clover_vm_compile(nullptr, "x = 1\n", nullptr));
+        clover_vm_destroy(vm);
+    }
+
+    TEST(EmbeddingApi, CallRejectsCodeFromAnotherVm)
+    {
+        clover_vm *first = clover_vm_new();
+        clover_vm *second = clover_vm_new();
+        clover_code *code = clover_vm_compile(first, "x = 1\n", nullptr);
+        ASSERT_NE(nullptr, code);
+
+        EXPECT_EQ(CLOVER_STATUS_ERROR, clover_vm_call(second, code));
+        EXPECT_EQ(CLOVER_STATUS_OK, clover_vm_call(first, code));
+
+        clover_code_destroy(code);
+        clover_vm_destroy(second);
+        clover_vm_destroy(first);
+    }
+
+    TEST(EmbeddingApi, VmsDoNotShareModuleState)
+    {
+        clover_vm *first = clover_vm_new();
+        clover_vm *second = clover_vm_new();
+
+        EXPECT_EQ(CLOVER_STATUS_OK,
+                  clover_vm_run_string(first,
+                                       "import sys\n"
+                                       "sys.embedding_marker = 1\n",
+                                       0));
+        EXPECT_EQ(CLOVER_STATUS_OK,
+                  clover_vm_run_string(second,
+                                       "import sys\n"
+                                       "try:\n"
+                                       "    sys.embedding_marker\n"
+                                       "    assert False\n"
+                                       "except AttributeError:\n"
+                                       "    pass\n",
+                                       0));
+
+        clover_vm_destroy(second);
+        clover_vm_destroy(first);
+    }
+
+    TEST(EmbeddingApi, IndependentVmsRunConcurrently)
+    {
+        static constexpr int kVmCount = 4;
+        static constexpr int kCallsPerVm = 20;
+        std::vector<int> failures(kVmCount, 0);
+        std::vector<std::thread> workers;
+        for(int idx = 0; idx < kVmCount; ++idx)
+        {
+            workers.emplace_back([idx, &failures] {
+                clover_vm *vm = clover_vm_new();
+                std::string source = "import sys\n"
+                                     "tag = " +
+                                     std::to_string(idx) +
+                                     "\n"
+                                     "try:\n"
+                                     "    assert sys.embedding_tag == tag\n"
+                                     "except AttributeError:\n"
+                                     "    sys.embedding_tag = tag\n"
+                                     "items = {}\n"
+                                     "for i in range(2000):\n"
+                                     "    items[i] = str(i * tag)\n"
+                                     "assert len(items) == 2000\n";
+                clover_code *code =
+                    clover_vm_compile(vm, source.c_str(), nullptr);
+                if(code == nullptr)
+                {
+                    failures[idx] = kCallsPerVm;
+                }
+                else
+                {
+                    for(int call = 0; call < kCallsPerVm; ++call)
+                    {
+                        if(clover_vm_call(vm, code) != CLOVER_STATUS_OK)
+                        {
+                            ++failures[idx];
+                        }
+                    }
+                    clover_code_destroy(code);
+                }
+                clover_vm_destroy(vm);
+            });
+        }
+        for(std::thread &worker: workers)
+        {
+            worker.join();
+        }
+        for(int idx = 0; idx < kVmCount; ++idx)
+        {
+            EXPECT_EQ(0, failures[idx]) << "vm " << idx;
+        }
+    }
+
+    TEST(EmbeddingApi, ForkedChildInheritsWarmVm)
+    {
+        clover_vm *vm = clover_vm_new();
+        ASSERT_EQ(CLOVER_STATUS_OK, clover_vm_run_string(vm,
+                                                         "import sys\n"
+                                                         "sys.warm = 41\n",
+                                                         0));
+        clover_code *code = clover_vm_compile(vm,
+                                              "import sys\n"
+                                              "sys.warm += 1\n"
+                                              "assert sys.warm == 42\n",
+                                              "warm.py");
+        ASSERT_NE(nullptr, code);
+        ASSERT_EQ(CLOVER_STATUS_OK, clover_vm_prepare_fork(vm));
+
+        pid_t pid = fork();
+        ASSERT_NE(-1, pid);
+        if(pid == 0)
+        {
+            _exit(clover_vm_call(vm, code) == CLOVER_STATUS_OK ? 0 : 1);
+        }
+        int status = 0;
+        ASSERT_EQ(pid, waitpid(pid, &status, 0));
+        ASSERT_TRUE(WIFEXITED(status));
+        EXPECT_EQ(0, WEXITSTATUS(status));
+
+        // The child's writes went to its own copy of the heap.
+        EXPECT_EQ(CLOVER_STATUS_OK, clover_vm_call(vm, code));
+
+        clover_code_destroy(code);
+        clover_vm_destroy(vm);
+    }
+
+    TEST(EmbeddingApi, PrepareForkRejectsRunningThreads)
+    {
+        clover_vm *vm = clover_vm_new();
+        ASSERT_EQ(CLOVER_STATUS_OK,
+                  clover_vm_run_string(vm,
+                                       "import _thread\n"
+                                       "import time\n"
+                                       "_thread.start_new_thread(time.sleep, "
+                                       "(0.05,))\n",
+                                       0));
+        EXPECT_EQ(CLOVER_STATUS_ERROR, clover_vm_prepare_fork(vm));
+        EXPECT_EQ(CLOVER_STATUS_ERROR, clover_vm_prepare_fork(nullptr));
+        clover_vm_destroy(vm);
+    }
+
+}  // namespace
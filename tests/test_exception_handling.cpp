@@ -4,6 +4,7 @@
 #include "runtime/exception_object.h"
 #include "runtime/exception_propagation.h"
 #include "runtime/thread_state.h"
+#include "runtime/traceback.h"
 #include "runtime/virtual_machine.h"
 #include "test_helpers.h"
 #include <gtest/gtest.h>
@@ -333,3 +334,188 @@ TEST(ExceptionHandling, reraise_active_exception_reenters_exception_unwind)
     EXPECT_EQ(Value::from_smi(99), actual);
     EXPECT_FALSE(test_context.thread()->has_pending_exception());
 }
+
+static CodeObject *
+make_pending_active_exception_handler_code(test::VmTestContext &test_context,
+                                           Value raised)
+{
+    TValue<String> name = test_context.vm().get_or_create_interned_string_value(
+        L"<pending-active-exception-test>");
+    CodeObjectBuilder builder(
+        &test_context.vm(), nullptr,
+        TValue<ModuleObject>::from_oop(test_context.make_test_module_object(
+            name, test_context.vm().global_builtins_module().raw_value())),
+        nullptr, name);
+    uint32_t constant_idx = builder.allocate_constant(raised).value();
+    JumpTarget handler(&builder);
+
+    {
+        ExceptionTableRangeBuilder range(&builder, handler);
+        builder.emit_lda_constant(0, uint8_t(constant_idx)).value();
+        builder.emit_raise_unwind(0).value();
+        range.close();
+    }
+
+    handler.resolve().value();
+    builder.emit_lda_smi(0, 42).value();
+    builder.emit_return(0).value();
+    return builder.finalize().value();
+}
+
+static CodeObject *
+make_unhandled_raise_code(test::VmTestContext &test_context, Value raised)
+{
+    TValue<String> name = test_context.vm().get_or_create_interned_string_value(
+        L"<unhandled-raise-test>");
+    CodeObjectBuilder builder(
+        &test_context.vm(), nullptr,
+        TValue<ModuleObject>::from_oop(test_context.make_test_module_object(
+            name, test_context.vm().global_builtins_module().raw_value())),
+        nullptr, name);
+    uint32_t constant_idx = builder.allocate_constant(raised).value();
+    builder.emit_lda_constant(0, uint8_t(constant_idx)).value();
+    builder.emit_raise_unwind(0).value();
+    return builder.finalize().value();
+}
+
+TEST(ExceptionHandling, raise_of_exception_class_defers_instance_allocation)
+{
+    test::VmTestContext test_context;
+    ThreadState::ActivationScope activation_scope(test_context.thread());
+    ClassObject *value_error =
+        test_context.thread()->class_for_builtin_name(L"ValueError");
+    CodeObject *code_obj = make_pending_active_exception_handler_code(
+        test_context, Value::from_oop(value_error));
+
+    Value actual = test_context.thread()->run_clovervm_code_object(code_obj);
+    EXPECT_EQ(Value::from_smi(42), actual);
+    ASSERT_EQ(PendingExceptionKind::Class,
+              test_context.thread()->pending_exception_kind());
+    EXPECT_EQ(value_error, test_context.thread()->pending_exception_class());
+    EXPECT_EQ(1u, test_context.thread()->pending_traceback().size());
+    test_context.thread()->clear_pending_exception();
+    EXPECT_TRUE(test_context.thread()->pending_traceback().empty());
+}
+
+TEST(ExceptionHandling, exception_class_is_materialized_at_native_boundary)
+{
+    test::VmTestContext test_context;
+    ThreadState::ActivationScope activation_scope(test_context.thread());
+    ClassObject *value_error =
+        test_context.thread()->class_for_builtin_name(L"ValueError");
+    CodeObject *code_obj =
+        make_unhandled_raise_code(test_context, Value::from_oop(value_error));
+
+    Value actual = test_context.thread()->run_clovervm_code_object(code_obj);
+    ASSERT_TRUE(actual.is_exception_marker());
+    ASSERT_EQ(PendingExceptionKind::Object,
+              test_context.thread()->pending_exception_kind());
+    EXPECT_EQ(value_error, test_context.thread()
+                               ->pending_exception_object()
+                               .extract()
+                               ->get_shape()
+                               ->get_class());
+    test_context.thread()->clear_pending_exception();
+}
+
+TEST(ExceptionHandling, drain_active_exception_builds_lazy_traceback)
+{
+    test::VmTestContext test_context;
+    ThreadState::ActivationScope activation_scope(test_context.thread());
+    Value exception_class = Value::from_oop(
+        test_context.thread()->class_for_builtin_name(L"Exception"));
+    CodeObject *code_obj =
+        make_drain_active_exception_handler_code(test_context, exception_class);
+
+    Value actual = test_context.thread()->run_clovervm_code_object(code_obj);
+    ASSERT_TRUE(can_convert_to<ExceptionObject>(actual));
+    Value traceback = actual.get_ptr<ExceptionObject>()->get_own_property(
+        test_context.vm().get_or_create_interned_string_value(
+            L"__traceback__"));
+    ASSERT_TRUE(traceback.is_ptr());
+    TracebackObject *entry = traceback.get_ptr<TracebackObject>();
+    EXPECT_EQ(NativeLayoutId::Traceback, entry->native_layout_id());
+    EXPECT_EQ(Value::from_oop(code_obj), entry->tb_code.value());
+    EXPECT_EQ(Value::None(), entry->tb_next.value());
+    EXPECT_TRUE(test_context.thread()->pending_traceback().empty());
+}
+
+TEST(ExceptionHandling, traceback_ring_keeps_raise_site_and_outermost_frames)
+{
+    TracebackRing ring;
+    uint32_t n_records = TracebackRing::kCapacity + 36;
+    for(uint32_t idx = 0; idx < n_records; ++idx)
+    {
+        ring.record(nullptr, idx);
+    }
+
+    ASSERT_EQ(TracebackRing::kCapacity, ring.size());
+    EXPECT_EQ(36u, ring.n_dropped());
+    for(uint32_t idx = 0; idx < TracebackRing::kHeadCapacity; ++idx)
+    {
+        EXPECT_EQ(idx, ring.entry(idx).pc_offset);
+    }
+    for(uint32_t idx = TracebackRing::kHeadCapacity; idx < ring.size(); ++idx)
+    {
+        EXPECT_EQ(n_records - ring.size() + idx, ring.entry(idx).pc_offset);
+    }
+}
+
+static const ExceptionTableEntry *
+find_exception_handler_by_scan(const CodeObject &code_object,
+                               uint32_t pc_offset)
+{
+    for(const ExceptionTableEntry &entry: code_object.exception_table)
+    {
+        if(pc_offset >= entry.start_pc && pc_offset < entry.end_pc)
+        {
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+TEST(ExceptionHandling, exception_handler_index_matches_table_priority)
+{
+    test::VmTestContext test_context;
+    ThreadState::ActivationScope activation_scope(test_context.thread());
+    CodeObject *code_obj = make_lda_active_exception_code(test_context);
+
+    // Nested, overlapping, adjacent, empty and disjoint ranges, innermost
+    // first as codegen emits them.
+    code_obj->exception_table = {
+        {4, 8, 100},   {12, 14, 101}, {2, 20, 102}, {20, 24, 102},
+        {30, 30, 103}, {0, 40, 104},  {50, 60, 105}, {55, 70, 106},
+    };
+    code_obj->build_exception_handler_index();
+
+    for(uint32_t pc = 0; pc < 80; ++pc)
+    {
+        EXPECT_EQ(find_exception_handler_by_scan(*code_obj, pc),
+                  code_obj->find_exception_handler(pc))
+            << "pc " << pc;
+    }
+    for(size_t idx = 1; idx < code_obj->exception_handler_index.size(); ++idx)
+    {
+        EXPECT_LE(code_obj->exception_handler_index[idx - 1].end_pc,
+                  code_obj->exception_handler_index[idx].start_pc);
+    }
+}
+
+TEST(ExceptionHandling, finalize_builds_exception_handler_index)
+{
+    test::VmTestContext test_context;
+    ThreadState::ActivationScope activation_scope(test_context.thread());
+    Value exception_class = Value::from_oop(
+        test_context.thread()->class_for_builtin_name(L"Exception"));
+    CodeObject *code_obj = make_reraise_active_exception_handler_code(
+        test_context, exception_class);
+
+    ASSERT_EQ(2u, code_obj->exception_table.size());
+    ASSERT_FALSE(code_obj->exception_handler_index.empty());
+    for(uint32_t pc = 0; pc < code_obj->code.size(); ++pc)
+    {
+        EXPECT_EQ(find_exception_handler_by_scan(*code_obj, pc),
+                  code_obj->find_exception_handler(pc));
+    }
+}
@@ -3,7 +3,10 @@
 #include "object_model/owned.h"
 #include "test_helpers.h"
 
+#include <bit>
+#include <cmath>
 #include <gtest/gtest.h>
+#include <limits>
 
 namespace cl
 {
@@ -12,14 +15,69 @@ namespace cl
         test::VmTestContext context;
         ThreadState::ActivationScope activation_scope(context.thread());
 
-        Owned<Value> first(box_float(context.thread(), 2.5));
-        Owned<Value> second(box_float(context.thread(), 2.5));
+        // Outside the immediate float range, so boxed in every build.
+        Owned<Value> first(box_float(context.thread(), 2.5e100));
+        Owned<Value> second(box_float(context.thread(), 2.5e100));
 
         ASSERT_TRUE(can_convert_to<Float>(first.raw_value()));
         ASSERT_TRUE(can_convert_to<Float>(second.raw_value()));
-        EXPECT_DOUBLE_EQ(2.5, first.raw_value().get_ptr<Float>()->value());
-        EXPECT_DOUBLE_EQ(2.5, second.raw_value().get_ptr<Float>()->value());
+        EXPECT_DOUBLE_EQ(2.5e100,
+                         first.raw_value().get_ptr<Float>()->value());
+        EXPECT_DOUBLE_EQ(2.5e100,
+                         second.raw_value().get_ptr<Float>()->value());
         EXPECT_NE(first.raw_value(), second.raw_value());
         EXPECT_FALSE(context.thread()->has_pending_exception());
     }
+
+    TEST(FloatRuntime, BoxFloatUsesImmediatesOnlyInsideTheImmediateRange)
+    {
+        test::VmTestContext context;
+        ThreadState::ActivationScope activation_scope(context.thread());
+
+        const double immediate_values[] = {
+            0.0,
+            1.0,
+            -1.5,
+            0.1,
+            3.141592653589793,
+            1e-9,
+            -4096.25,
+            std::ldexp(1.0, -31),
+            std::nextafter(std::ldexp(1.0, 32), 0.0),
+        };
+        const double boxed_values[] = {
+            -0.0,
+            std::ldexp(1.0, 32),
+            std::nextafter(std::ldexp(1.0, -31), 0.0),
+            1e100,
+            5e-324,
+            std::numeric_limits<double>::infinity(),
+            std::numeric_limits<double>::quiet_NaN(),
+        };
+
+        for(double expected: immediate_values)
+        {
+            SCOPED_TRACE(expected);
+            Owned<Value> boxed(box_float(context.thread(), expected));
+            ASSERT_TRUE(is_float_value(boxed.raw_value()));
+            EXPECT_EQ(std::bit_cast<uint64_t>(expected),
+                      std::bit_cast<uint64_t>(float_value(boxed.raw_value())));
+            EXPECT_EQ(value_immediate_floats,
+                      boxed.raw_value().is_immediate_float());
+            if(boxed.raw_value().is_immediate_float())
+            {
+                EXPECT_EQ(expected != 0.0, boxed.raw_value().is_truthy());
+                EXPECT_EQ(context.vm().float_class(),
+                          context.thread()->class_of_value(boxed.raw_value()));
+            }
+        }
+        for(double expected: boxed_values)
+        {
+            SCOPED_TRACE(expected);
+            Owned<Value> boxed(box_float(context.thread(), expected));
+            ASSERT_TRUE(can_convert_to<Float>(boxed.raw_value()));
+            EXPECT_EQ(std::bit_cast<uint64_t>(expected),
+                      std::bit_cast<uint64_t>(float_value(boxed.raw_value())));
+        }
+    }
 }  // namespace cl
@@ -1,9 +1,12 @@
 #include "test_helpers.h"
 
+#include "builtin_types/float.h"
 #include "builtin_types/module_object.h"
 #include "builtin_types/tuple.h"
 #include "memory/global_heap.h"
 #include "memory/heap_reclamation.h"
+#include "object_model/class_object.h"
+#include "object_model/instance.h"
 #include "object_model/refcount.h"
 #include "object_model/shape.h"
 #include "object_model/validity_cell.h"
@@ -177,6 +180,41 @@ namespace cl
         *slot = Value::not_present();
     }
 
+#if CL_REFCOUNT_MODE == CL_REFCOUNT_MODE_BIASED
+    TEST(HeapReclamation, ForeignReleaseMergesIntoOwnerCountAtReclamation)
+    {
+        test::VmTestContext context;
+        ThreadState *owner = context.thread();
+        ThreadState *foreign = context.vm().make_new_thread();
+        ThreadState::ActivationScope active_thread(owner);
+        String *string = owner->make_object_raw<String>(L"biased");
+        incref_heap_ptr(string);
+        {
+            ThreadState::ActivationScope foreign_thread(foreign);
+            incref_heap_ptr(string);
+            EXPECT_EQ(1, string->refcount);
+            EXPECT_EQ(1, string->shared_refcount);
+            decref_heap_ptr(string);
+            decref_heap_ptr(string);
+        }
+        EXPECT_EQ(1, string->refcount);
+        EXPECT_EQ(-1, string->shared_refcount);
+        EXPECT_EQ(0, heap_object_refcount(string));
+        EXPECT_EQ(HeapLifecycleState::Normal, string->lifecycle_state);
+
+        Value *slot = owner->clover_frame_sentinel() - 1;
+        *slot = Value::from_oop(string);
+        owner->publish_safepoint_scan_record(slot, Value::not_present());
+        context.vm().run_heap_reclamation();
+
+        EXPECT_EQ(0, string->refcount);
+        EXPECT_EQ(0, string->shared_refcount);
+        EXPECT_EQ(HeapLifecycleState::InZct, string->lifecycle_state);
+        EXPECT_TRUE(owner->zero_count_table_contains_for_testing(string));
+        *slot = Value::not_present();
+    }
+#endif
+
     TEST(HeapReclamation, FullReclamationReclaimsUnrootedZctEntry)
     {
         test::VmTestContext context;
@@ -550,4 +588,225 @@ namespace cl
         EXPECT_EQ(valid_objects_before_alloc + 3,
                   heap.count_valid_objects_slow());
     }
+
+    TEST(HeapReclamation, EpochScanPromotesSurvivingYoungObject)
+    {
+        test::VmTestContext context;
+        ThreadState *thread = context.thread();
+        ThreadState::ActivationScope active_thread(thread);
+
+        ValidityCell *object = thread->make_internal_raw<ValidityCell>(
+            ValidityCellDependencyMutability::Mutable);
+        incref_heap_ptr(object);
+        ASSERT_EQ(HeapGeneration::Young, object->generation);
+
+        context.vm().run_heap_reclamation();
+
+        EXPECT_EQ(HeapGeneration::Old, object->generation);
+        decref_heap_ptr(object);
+        context.vm().run_heap_reclamation();
+    }
+
+    namespace
+    {
+        Instance *make_old_instance(test::VmTestContext &context,
+                                    TValue<String> attr_name)
+        {
+            ThreadState *thread = context.thread();
+            ClassObject *cls = thread->make_internal_raw<ClassObject>(
+                context.vm().get_or_create_interned_string_value(L"Cls"), 2,
+                context.vm().object_class(), NativeLayoutId::Instance);
+            Instance *instance = thread->make_internal_raw<Instance>(cls);
+            incref_heap_ptr(instance);
+            instance->set_own_property(attr_name, Value::from_smi(1));
+            context.vm().run_heap_reclamation();
+            return instance;
+        }
+    }  // namespace
+
+    TEST(HeapReclamation, YoungStoreIntoOldInstanceIsRememberedUntilPromotion)
+    {
+        test::VmTestContext context;
+        ThreadState *thread = context.thread();
+        ThreadState::ActivationScope active_thread(thread);
+        GlobalHeap &heap = context.vm().get_refcounted_global_heap();
+        TValue<String> attr_name(
+            context.vm().get_or_create_interned_string_value(L"value"));
+        Instance *instance = make_old_instance(context, attr_name);
+        ASSERT_EQ(HeapGeneration::Old, instance->generation);
+        ASSERT_EQ(HeapGeneration::Old, instance->get_shape()->generation);
+        ASSERT_EQ(0u, thread->remembered_set_size());
+
+        String *first = thread->make_object_raw<String>(L"first");
+        String *second = thread->make_object_raw<String>(L"second");
+        instance->set_own_property(attr_name, Value::from_oop(first));
+        instance->set_own_property(attr_name, Value::from_oop(second));
+
+        EXPECT_EQ(HeapGeneration::OldRemembered, instance->generation);
+        EXPECT_EQ(1u, thread->remembered_set_size());
+        EXPECT_TRUE(thread->remembered_set_contains_for_testing(instance));
+        EXPECT_EQ(0u, count_unremembered_old_to_young_edges(heap));
+
+        context.vm().run_heap_reclamation();
+
+        EXPECT_EQ(HeapGeneration::Old, instance->generation);
+        EXPECT_EQ(HeapGeneration::Old, second->generation);
+        EXPECT_EQ(0u, thread->remembered_set_size());
+        EXPECT_EQ(0u, count_unremembered_old_to_young_edges(heap));
+        decref_heap_ptr(instance);
+        context.vm().run_heap_reclamation();
+    }
+
+    TEST(HeapReclamation, EdgeCheckerReportsUnrememberedOldToYoungEdge)
+    {
+        test::VmTestContext context;
+        ThreadState *thread = context.thread();
+        ThreadState::ActivationScope active_thread(thread);
+        GlobalHeap &heap = context.vm().get_refcounted_global_heap();
+        TValue<String> attr_name(
+            context.vm().get_or_create_interned_string_value(L"value"));
+        Instance *instance = make_old_instance(context, attr_name);
+
+        instance->set_own_property(
+            attr_name,
+            Value::from_oop(thread->make_object_raw<String>(L"young")));
+        thread->clear_remembered_set();
+
+        EXPECT_EQ(HeapGeneration::Old, instance->generation);
+        EXPECT_EQ(1u, count_unremembered_old_to_young_edges(heap));
+        decref_heap_ptr(instance);
+        context.vm().run_heap_reclamation();
+    }
+
+    TEST(HeapReclamation, AttributeWorkloadLeavesNoUnrememberedOldToYoungEdge)
+    {
+        test::VmTestContext context;
+        ThreadState::ActivationScope active_thread(context.thread());
+        context.vm().set_fire_every_safepoint_for_testing(true);
+
+        Value result = context.run_file(L"class Node:\n"
+                                        L"    pass\n"
+                                        L"root = Node()\n"
+                                        L"root.head = None\n"
+                                        L"for i in range(200):\n"
+                                        L"    node = Node()\n"
+                                        L"    node.value = str(i)\n"
+                                        L"    node.next = root.head\n"
+                                        L"    root.head = node\n"
+                                        L"    root.a = str(i)\n"
+                                        L"    root.b = str(i)\n"
+                                        L"    root.c = str(i)\n"
+                                        L"    root.d = str(i)\n"
+                                        L"    root.e = str(i)\n"
+                                        L"    root.f = str(i)\n"
+                                        L"    Node.last = str(i)\n"
+                                        L"    latest = str(i)\n");
+
+        ASSERT_FALSE(result.is_exception_marker());
+        EXPECT_EQ(0u, count_unremembered_old_to_young_edges(
+                          context.vm().get_refcounted_global_heap()));
+        EXPECT_EQ(0u, count_unremembered_old_to_young_edges(
+                          context.vm().get_interned_global_heap()));
+    }
+
+    // The floats below are outside the immediate float range, so they are
+    // boxed in every CLOVERVM_FLOAT_ENCODING.
+    TEST(HeapReclamation, ReclaimedFloatCellIsReusedByNextBoxedFloat)
+    {
+        test::VmTestContext context;
+        ThreadState *thread = context.thread();
+        ThreadState::ActivationScope active_thread(thread);
+        GlobalHeap &heap = context.vm().get_refcounted_global_heap();
+        context.vm().run_heap_reclamation();
+        HeapObject *dead = box_float(thread, 1.5e100).as.ptr;
+        SlabAllocator *slab = heap.slab_for_object_unlocked(dead);
+
+        context.vm().run_heap_reclamation();
+
+        EXPECT_FALSE(slab_has_valid_object(slab, dead));
+        size_t recycled = thread->recycled_cell_count();
+        ASSERT_GT(recycled, 0u);
+        bool reused = false;
+        for(size_t idx = 0; idx < recycled; ++idx)
+        {
+            HeapObject *boxed = box_float(thread, 2.5e100).as.ptr;
+            EXPECT_TRUE(thread->zero_count_table_contains_for_testing(boxed));
+            EXPECT_EQ(HeapGeneration::Young, boxed->generation);
+            reused = reused || boxed == dead;
+        }
+        EXPECT_TRUE(reused);
+        EXPECT_EQ(0u, thread->recycled_cell_count());
+        EXPECT_TRUE(slab_has_valid_object(slab, dead));
+        EXPECT_EQ(2.5e100, static_cast<Float *>(dead)->value());
+
+        context.vm().run_heap_reclamation();
+        EXPECT_FALSE(slab_has_valid_object(slab, dead));
+    }
+
+    TEST(HeapReclamation, UnusedRecycledFloatCellsAreDroppedAtNextReclamation)
+    {
+        test::VmTestContext context;
+        ThreadState *thread = context.thread();
+        ThreadState::ActivationScope active_thread(thread);
+        GlobalHeap &heap = context.vm().get_refcounted_global_heap();
+        context.vm().run_heap_reclamation();
+        uint64_t blockers_before = heap.total_reclaim_blockers_for_testing();
+        (void)box_float(thread, 1.5e100);
+        context.vm().run_heap_reclamation();
+        ASSERT_GT(thread->recycled_cell_count(), 0u);
+
+        context.vm().run_heap_reclamation();
+
+        EXPECT_EQ(0u, thread->recycled_cell_count());
+        EXPECT_EQ(blockers_before, heap.total_reclaim_blockers_for_testing());
+    }
+
+    TEST(HeapReclamation, UsingUpARefilledRecycledListRequestsReclamation)
+    {
+        test::VmTestContext context;
+        ThreadState *thread = context.thread();
+        ThreadState::ActivationScope active_thread(thread);
+        context.vm().run_heap_reclamation();
+        for(size_t idx = 0; idx < ThreadLocalHeap::RecycledCellLimit; ++idx)
+        {
+            (void)box_float(thread, 1.5e100);
+        }
+        context.vm().run_heap_reclamation();
+        size_t recycled = thread->recycled_cell_count();
+        ASSERT_GE(recycled, ThreadLocalHeap::RecycledCellLimit / 2);
+        context.vm().clear_safepoint_request();
+
+        for(size_t idx = 0; idx + 1 < recycled; ++idx)
+        {
+            (void)box_float(thread, 2.5e100);
+        }
+        EXPECT_FALSE(thread->safepoint_requested());
+        (void)box_float(thread, 2.5e100);
+        EXPECT_TRUE(thread->safepoint_requested());
+
+        context.vm().clear_safepoint_request();
+        context.vm().run_heap_reclamation();
+    }
+
+    TEST(HeapReclamation, RootedFloatInRecycledCellSurvivesAndIsPromoted)
+    {
+        test::VmTestContext context;
+        ThreadState *thread = context.thread();
+        ThreadState::ActivationScope active_thread(thread);
+        context.vm().run_heap_reclamation();
+        (void)box_float(thread, 1.5e100);
+        context.vm().run_heap_reclamation();
+        ASSERT_GT(thread->recycled_cell_count(), 0u);
+        Value boxed = box_float(thread, 3.5e100);
+        Value *slot = thread->clover_frame_sentinel() - 1;
+        *slot = boxed;
+        thread->publish_safepoint_scan_record(slot, Value::not_present());
+
+        context.vm().run_heap_reclamation();
+
+        EXPECT_TRUE(thread->zero_count_table_contains_for_testing(boxed.as.ptr));
+        EXPECT_EQ(HeapGeneration::Old, boxed.as.ptr->generation);
+        EXPECT_EQ(3.5e100, boxed.get_ptr<Float>()->value());
+        *slot = Value::not_present();
+    }
 }  // namespace cl
@@ -671,7 +671,7 @@ TEST(Interpreter, trace_interpreter_instructions_prints_executed_bytecode)
 
     EXPECT_EQ(Value::from_smi(7), actual);
     EXPECT_NE(std::string::npos, trace.find(">>> enter f\n"));
-    EXPECT_NE(std::string::npos, trace.find("CallPositional"));
+    EXPECT_NE(std::string::npos, trace.find("CallGlobalSimple"));
     EXPECT_NE(std::string::npos, trace.find("LdaSmi 7"));
     EXPECT_NE(std::string::npos, trace.find("Return"));
 }
@@ -1208,8 +1208,8 @@ TEST(Interpreter, float_literal_values)
 
     auto expect_float_literal = [&](const wchar_t *source, double expected) {
         Value actual = test_context.run_file(source);
-        ASSERT_TRUE(can_convert_to<Float>(actual));
-        EXPECT_DOUBLE_EQ(expected, actual.get_ptr<Float>()->value());
+        ASSERT_TRUE(is_float_value(actual));
+        EXPECT_DOUBLE_EQ(expected, float_value(actual));
     };
 
     expect_float_literal(L"1.0\n", 1.0);
@@ -1221,31 +1221,31 @@ TEST(Interpreter, float_literal_values)
     expect_float_literal(L"1_2.3_4\n", 12.34);
 
     Value huge_actual = test_context.run_file(L"1e1000\n");
-    ASSERT_TRUE(can_convert_to<Float>(huge_actual));
-    EXPECT_TRUE(std::isinf(huge_actual.get_ptr<Float>()->value()));
-    EXPECT_FALSE(std::signbit(huge_actual.get_ptr<Float>()->value()));
+    ASSERT_TRUE(is_float_value(huge_actual));
+    EXPECT_TRUE(std::isinf(float_value(huge_actual)));
+    EXPECT_FALSE(std::signbit(float_value(huge_actual)));
 
     Value negative_huge_actual = test_context.run_file(L"-1e1000\n");
-    ASSERT_TRUE(can_convert_to<Float>(negative_huge_actual));
-    EXPECT_TRUE(std::isinf(negative_huge_actual.get_ptr<Float>()->value()));
-    EXPECT_TRUE(std::signbit(negative_huge_actual.get_ptr<Float>()->value()));
+    ASSERT_TRUE(is_float_value(negative_huge_actual));
+    EXPECT_TRUE(std::isinf(float_value(negative_huge_actual)));
+    EXPECT_TRUE(std::signbit(float_value(negative_huge_actual)));
 
     Value tiny_actual = test_context.run_file(L"1e-1000\n");
-    ASSERT_TRUE(can_convert_to<Float>(tiny_actual));
-    EXPECT_EQ(0.0, tiny_actual.get_ptr<Float>()->value());
-    EXPECT_FALSE(std::signbit(tiny_actual.get_ptr<Float>()->value()));
+    ASSERT_TRUE(is_float_value(tiny_actual));
+    EXPECT_EQ(0.0, float_value(tiny_actual));
+    EXPECT_FALSE(std::signbit(float_value(tiny_actual)));
 
     Value negative_tiny_actual = test_context.run_file(L"-1e-1000\n");
-    ASSERT_TRUE(can_convert_to<Float>(negative_tiny_actual));
-    EXPECT_EQ(0.0, negative_tiny_actual.get_ptr<Float>()->value());
-    EXPECT_TRUE(std::signbit(negative_tiny_actual.get_ptr<Float>()->value()));
+    ASSERT_TRUE(is_float_value(negative_tiny_actual));
+    EXPECT_EQ(0.0, float_value(negative_tiny_actual));
+    EXPECT_TRUE(std::signbit(float_value(negative_tiny_actual)));
 
     std::wstring tiny_decimal_source = L"0." + std::wstring(400, L'0') + L"1\n";
     Value tiny_decimal_actual =
         test_context.run_file(tiny_decimal_source.c_str());
-    ASSERT_TRUE(can_convert_to<Float>(tiny_decimal_actual));
-    EXPECT_EQ(0.0, tiny_decimal_actual.get_ptr<Float>()->value());
-    EXPECT_FALSE(std::signbit(tiny_decimal_actual.get_ptr<Float>()->value()));
+    ASSERT_TRUE(is_float_value(tiny_decimal_actual));
+    EXPECT_EQ(0.0, float_value(tiny_decimal_actual));
+    EXPECT_FALSE(std::signbit(float_value(tiny_decimal_actual)));
 }
 
 TEST(Interpreter, builtin_pow_with_modulo_rejects_binary_only_pow)
@@ -1354,8 +1354,8 @@ TEST(Interpreter, unary_float_handler_has_registered_metadata)
                                                      L"negate(2.5)\n");
 
     Value actual = test_context.thread()->run_clovervm_code_object(code_obj);
-    ASSERT_TRUE(can_convert_to<Float>(actual));
-    EXPECT_DOUBLE_EQ(-2.5, actual.get_ptr<Float>()->value());
+    ASSERT_TRUE(is_float_value(actual));
+    EXPECT_DOUBLE_EQ(-2.5, float_value(actual));
 
     Value function_value =
         load_global_from_module_for_test(code_obj, function_name);
@@ -1412,6 +1412,122 @@ TEST(Interpreter, unary_positive_float_preserves_exact_identity)
     EXPECT_EQ(TrustedHandlerSemantics::Pos, metadata->semantics);
 }
 
+TEST(Interpreter, builtin_len_call_site_specializes_on_argument_shape)
+{
+    test::VmTestContext test_context;
+    ThreadState::ActivationScope activation_scope(test_context.thread());
+
+    TValue<String> function_name(
+        test_context.vm().get_or_create_interned_string_value(L"measure"));
+    CodeObject *code_obj =
+        test_context.compile_file(L"def measure(value):\n"
+                                  L"    return len(value)\n"
+                                  L"assert measure([1, 2, 3]) == 3\n"
+                                  L"assert measure([1]) == 1\n");
+
+    Value actual = test_context.thread()->run_clovervm_code_object(code_obj);
+    ASSERT_FALSE(actual.is_exception_marker());
+
+    Value function_value =
+        load_global_from_module_for_test(code_obj, function_name);
+    ASSERT_TRUE(can_convert_to<Function>(function_value));
+    CodeObject *function_code =
+        assume_convert_to<Function>(function_value)->code_object.extract();
+    ASSERT_EQ(1u, function_code->inline_caches.function_call_caches.size());
+    const FunctionCallInlineCache &cache =
+        function_code->inline_caches.function_call_caches[0];
+    EXPECT_EQ(FunctionCallAdaptation::Specialized, cache.adaptation);
+    EXPECT_EQ(1u, cache.n_specialization_guards);
+    ASSERT_FALSE(cache.specialized_handler.is_null());
+
+    std::optional<TrustedHandlerMetadata> metadata =
+        test_context.vm().trusted_handler_metadata(
+            cache.specialized_handler.target(TrustedHandlerArity::Unary));
+    ASSERT_TRUE(metadata.has_value());
+    EXPECT_EQ(TrustedHandlerArity::Unary, metadata->arity);
+    EXPECT_EQ(TrustedHandlerSemantics::Length, metadata->semantics);
+}
+
+TEST(Interpreter, builtin_min_call_site_specializes_smi_pairs)
+{
+    test::VmTestContext test_context;
+    ThreadState::ActivationScope activation_scope(test_context.thread());
+
+    TValue<String> function_name(
+        test_context.vm().get_or_create_interned_string_value(L"smaller"));
+    CodeObject *code_obj =
+        test_context.compile_file(L"def smaller(a, b):\n"
+                                  L"    return min(a, b)\n"
+                                  L"assert smaller(4, 2) == 2\n"
+                                  L"assert smaller(1, 3) == 1\n");
+
+    Value actual = test_context.thread()->run_clovervm_code_object(code_obj);
+    ASSERT_FALSE(actual.is_exception_marker());
+
+    Value function_value =
+        load_global_from_module_for_test(code_obj, function_name);
+    ASSERT_TRUE(can_convert_to<Function>(function_value));
+    CodeObject *function_code =
+        assume_convert_to<Function>(function_value)->code_object.extract();
+    ASSERT_EQ(1u, function_code->inline_caches.function_call_caches.size());
+    const FunctionCallInlineCache &cache =
+        function_code->inline_caches.function_call_caches[0];
+    EXPECT_EQ(FunctionCallAdaptation::Specialized, cache.adaptation);
+    EXPECT_EQ(2u, cache.n_specialization_guards);
+    ASSERT_FALSE(cache.specialized_handler.is_null());
+
+    std::optional<TrustedHandlerMetadata> metadata =
+        test_context.vm().trusted_handler_metadata(
+            cache.specialized_handler.target(TrustedHandlerArity::Binary));
+    ASSERT_TRUE(metadata.has_value());
+    EXPECT_EQ(TrustedHandlerArity::Binary, metadata->arity);
+    EXPECT_EQ(TrustedHandlerEffects::None, metadata->effects);
+    EXPECT_EQ(TrustedHandlerSemantics::Min, metadata->semantics);
+}
+
+TEST(Interpreter, builtin_call_specialization_demotes_on_shape_change)
+{
+    test::VmTestContext test_context;
+    ThreadState::ActivationScope activation_scope(test_context.thread());
+
+    TValue<String> function_name(
+        test_context.vm().get_or_create_interned_string_value(L"measure"));
+    CodeObject *code_obj =
+        test_context.compile_file(L"def measure(value):\n"
+                                  L"    return len(value)\n"
+                                  L"assert measure([1, 2, 3]) == 3\n"
+                                  L"assert measure('ab') == 2\n"
+                                  L"assert measure([1]) == 1\n");
+
+    Value actual = test_context.thread()->run_clovervm_code_object(code_obj);
+    ASSERT_FALSE(actual.is_exception_marker());
+
+    Value function_value =
+        load_global_from_module_for_test(code_obj, function_name);
+    ASSERT_TRUE(can_convert_to<Function>(function_value));
+    CodeObject *function_code =
+        assume_convert_to<Function>(function_value)->code_object.extract();
+    ASSERT_EQ(1u, function_code->inline_caches.function_call_caches.size());
+    const FunctionCallInlineCache &cache =
+        function_code->inline_caches.function_call_caches[0];
+    EXPECT_NE(FunctionCallAdaptation::Specialized, cache.adaptation);
+    EXPECT_EQ(0u, cache.n_specialization_guards);
+    EXPECT_TRUE(cache.specialized_handler.is_null());
+}
+
+TEST(Interpreter, specialized_getattr_raises_for_missing_attribute)
+{
+    expect_python_error(L"class Point:\n"
+                        L"    pass\n"
+                        L"def lookup(obj):\n"
+                        L"    return getattr(obj, 'x')\n"
+                        L"point = Point()\n"
+                        L"point.x = 1\n"
+                        L"lookup(point)\n"
+                        L"lookup(Point())\n",
+                        L"AttributeError", L"object has no such attribute");
+}
+
 TEST(Interpreter, membership_fallback_does_not_index_when_iter_exists)
 {
     expect_python_error(L"class Sequence:\n"
@@ -1837,8 +1953,8 @@ TEST(Interpreter, operator_add_dispatch_reflected_float_trusted_cache_hit)
                                   L"add(2, 1.5)\n");
 
     Value actual = test_context.thread()->run_clovervm_code_object(code_obj);
-    ASSERT_TRUE(can_convert_to<Float>(actual));
-    EXPECT_DOUBLE_EQ(3.5, actual.get_ptr<Float>()->value());
+    ASSERT_TRUE(is_float_value(actual));
+    EXPECT_DOUBLE_EQ(3.5, float_value(actual));
 
     Value function_value =
         load_global_from_module_for_test(code_obj, function_name);
@@ -3372,6 +3488,133 @@ TEST(Interpreter, call_non_callable_unwinds_nested_frames)
                         L"TypeError", L"object is not callable");
 }
 
+TEST(Interpreter, global_call_observes_rebinding)
+{
+    test::VmTestContext test_context;
+    Value actual = test_context.run_file(L"def helper(x):\n"
+                                         L"    return x + 1\n"
+                                         L"def other(x):\n"
+                                         L"    return x + 100\n"
+                                         L"def call(x):\n"
+                                         L"    return helper(x)\n"
+                                         L"total = call(1) + call(2)\n"
+                                         L"helper = other\n"
+                                         L"total = total + call(3)\n"
+                                         L"del helper\n"
+                                         L"def helper(x, y=1000):\n"
+                                         L"    return x + y\n"
+                                         L"total + call(4)\n");
+
+    EXPECT_EQ(Value::from_smi(2 + 3 + 103 + 1004), actual);
+}
+
+TEST(Interpreter, global_call_missing_callee_raises_name_error)
+{
+    expect_python_error(L"def call():\n"
+                        L"    return helper(1)\n"
+                        L"call()\n",
+                        L"NameError", L"name 'helper' is not defined");
+    expect_python_error(L"def helper(x):\n"
+                        L"    return x\n"
+                        L"def call():\n"
+                        L"    return helper(1)\n"
+                        L"call()\n"
+                        L"del helper\n"
+                        L"call()\n",
+                        L"NameError", L"name 'helper' is not defined");
+}
+
+TEST(Interpreter, global_call_non_callable_raises_type_error)
+{
+    expect_python_error(L"helper = 1\n"
+                        L"def call():\n"
+                        L"    return helper(1)\n"
+                        L"call()\n",
+                        L"TypeError", L"object is not callable");
+}
+
+TEST(Interpreter, unpack_call_forwards_varying_arity_through_one_site)
+{
+    test::VmTestContext test_context;
+    Value actual = test_context.run_file(L"def target(a, b, c=5):\n"
+                                         L"    return a * 100 + b * 10 + c\n"
+                                         L"def wrapper(*args):\n"
+                                         L"    return target(*args)\n"
+                                         L"total = 0\n"
+                                         L"for i in range(3):\n"
+                                         L"    total = total + wrapper(1, 2)\n"
+                                         L"total + wrapper(1, 2, 3)\n");
+
+    EXPECT_EQ(Value::from_smi(3 * 125 + 123), actual);
+}
+
+TEST(Interpreter, unpack_call_passes_method_self)
+{
+    test::VmTestContext test_context;
+    Value actual =
+        test_context.run_file(L"class C:\n"
+                              L"    def __init__(self):\n"
+                              L"        self.base = 1000\n"
+                              L"    def m(self, a, b, scale=1):\n"
+                              L"        return self.base + (a - b) * scale\n"
+                              L"c = C()\n"
+                              L"args = [7, 2]\n"
+                              L"c.m(*args) + c.m(*args, **{'scale': 10})\n");
+
+    EXPECT_EQ(Value::from_smi(1005 + 1050), actual);
+}
+
+TEST(Interpreter, unpack_call_looks_up_method_before_arguments)
+{
+    test::VmTestContext test_context;
+    Value actual = test_context.run_file(L"class C:\n"
+                                         L"    def m(self, a):\n"
+                                         L"        return 1\n"
+                                         L"def other(self, a):\n"
+                                         L"    return 2\n"
+                                         L"def rebind():\n"
+                                         L"    C.m = other\n"
+                                         L"    return [0]\n"
+                                         L"C().m(*rebind())\n");
+
+    EXPECT_EQ(Value::from_smi(1), actual);
+}
+
+TEST(Interpreter, unpack_call_rejects_unsupported_operands)
+{
+    expect_python_error(L"def f(*args):\n"
+                        L"    return args\n"
+                        L"f(*1)\n",
+                        L"TypeError",
+                        L"argument after * must be a list or tuple");
+    expect_python_error(L"def f(*args):\n"
+                        L"    return args\n"
+                        L"f(1, *2, 3)\n",
+                        L"TypeError",
+                        L"argument after * must be a list or tuple");
+    expect_python_error(L"def f(**kwargs):\n"
+                        L"    return kwargs\n"
+                        L"f(**[1])\n",
+                        L"TypeError", L"argument after ** must be a dict");
+    expect_python_error(L"def f(**kwargs):\n"
+                        L"    return kwargs\n"
+                        L"f(**{1: 2})\n",
+                        L"TypeError", L"keywords must be strings");
+}
+
+TEST(Interpreter, unpack_call_rejects_repeated_keywords)
+{
+    expect_python_error(L"def f(**kwargs):\n"
+                        L"    return kwargs\n"
+                        L"f(**{'a': 1}, a=2)\n",
+                        L"TypeError",
+                        L"got multiple values for keyword argument");
+    expect_python_error(L"def f(a):\n"
+                        L"    return a\n"
+                        L"f(*[1], **{'a': 2})\n",
+                        L"TypeError", L"invalid keyword argument");
+}
+
 TEST(Interpreter, call_intrinsic_zero_arg_function)
 {
     test::VmTestContext test_context;
@@ -4877,7 +5120,7 @@ TEST(Interpreter, float_objects_have_builtin_class_and_string_methods)
 
     Value value =
         test_context.thread()->make_object_value<Float>(1.5).raw_value();
-    ASSERT_TRUE(can_convert_to<Float>(value));
+    ASSERT_TRUE(is_float_value(value));
     EXPECT_EQ(NativeLayoutId::Float,
               value.get_ptr<Object>()->native_layout_id());
     EXPECT_EQ(test_context.vm().float_class(),
@@ -4942,8 +5185,8 @@ TEST(Interpreter, float_objects_have_builtin_class_and_string_methods)
                                           Value argument, double expected) {
         Value result = test_context.thread()->call_clovervm_method(
             receiver, name, argument);
-        ASSERT_TRUE(can_convert_to<Float>(result));
-        EXPECT_DOUBLE_EQ(expected, result.get_ptr<Float>()->value());
+        ASSERT_TRUE(is_float_value(result));
+        EXPECT_DOUBLE_EQ(expected, float_value(result));
     };
 
     Value equal_float = test_context.thread()->call_clovervm_method(
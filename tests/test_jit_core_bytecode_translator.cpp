@@ -1198,6 +1198,43 @@ namespace cl::jit
         EXPECT_TRUE(entry->block_successor_edges().empty());
     }
 
+    TEST(JitCoreBytecodeTranslator, GlobalCallResumesInInterpreterAtTheCall)
+    {
+        TranslatorFixture fixture;
+        uint32_t name_index =
+            fixture.code_builder.allocate_constant(fixture.name.raw_value())
+                .value();
+        uint32_t call_pc;
+        {
+            CodeObjectBuilder::TemporaryReg callable(fixture.code_builder);
+            CodeObjectBuilder::TemporaryReg call_args(
+                fixture.code_builder, 1, RegisterAlignment::CallFrame);
+            fixture.code_builder.emit_lda_smi(0, 5).value();
+            fixture.code_builder.emit_star(0, call_args).value();
+            call_pc = fixture.code_builder
+                          .emit_call_global_simple(0, uint8_t(name_index),
+                                                   callable, call_args, 1)
+                          .value();
+            fixture.code_builder.emit_return(0).value();
+        }
+
+        ControlFlowGraph *graph = fixture.translate();
+        Block *entry = graph->entry_block();
+        std::vector<Instruction> snapshots =
+            instructions_of_kind(entry, InstructionKind::Snapshot);
+        std::vector<Instruction> resumes =
+            instructions_of_kind(entry, InstructionKind::ResumeInInterpreter);
+        ASSERT_EQ(1u, snapshots.size());
+        ASSERT_EQ(1u, resumes.size());
+        SnapshotInstruction snapshot =
+            snapshots.front().as<SnapshotInstruction>();
+        EXPECT_EQ(call_pc, snapshot.resume_pc_offset());
+        ASSERT_EQ(bytecode_state_size(*graph),
+                  snapshot.captured_values().size());
+        EXPECT_EQ(resumes.front().id(),
+                  entry->instruction_at(entry->instructions().size() - 1).id());
+    }
+
     TEST(JitCoreBytecodeTranslator,
          EntryParameterAliasesIntoCompleteSnapshotState)
     {
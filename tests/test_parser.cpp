@@ -504,8 +504,8 @@ TEST(Parser, float_literal_stores_constant_value)
                 AstOperatorKind::NUMBER);
 
     Value constant = parsed.ast.constants[literal_idx];
-    ASSERT_TRUE(can_convert_to<Float>(constant));
-    EXPECT_DOUBLE_EQ(1.5, constant.get_ptr<Float>()->value());
+    ASSERT_TRUE(is_float_value(constant));
+    EXPECT_DOUBLE_EQ(1.5, float_value(constant));
 }
 
 TEST(Parser, ellipsis_literal_stores_constant_value)
@@ -665,6 +665,24 @@ TEST(Parser, calls_reject_repeated_keyword_arguments)
                        "SyntaxError: keyword argument repeated");
 }
 
+TEST(Parser, calls_accept_argument_unpacking)
+{
+    std::string expected = "f(1, *a, b=2, *c, **d, e=3)\n";
+    std::string actual = parse(L"f(1, *a, b=2, *c, **d, e=3)\n");
+
+    EXPECT_EQ(expected, actual);
+}
+
+TEST(Parser, calls_reject_arguments_after_keyword_unpacking)
+{
+    expect_parse_error(
+        L"f(**a, 1)\n",
+        "SyntaxError: positional argument follows keyword argument unpacking");
+    expect_parse_error(L"f(**a, *b)\n",
+                       "SyntaxError: iterable argument unpacking follows "
+                       "keyword argument unpacking");
+}
+
 TEST(Parser, parameters_accept_trailing_comma)
 {
     std::string expected = (""